@@ -1,8 +1,14 @@
-﻿#include <iostream>
+﻿#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
 #include "allocator.h"
 #include <string>
 #include <cstddef>
 #include <new>
+#include <map>
+#include <thread>
+#include <vector>
 #include "logger.h"
 #include "logger_concrete.h"
 #include "logger_builder.h"
@@ -11,6 +17,17 @@
 #include "allocator_sorted_list.h"
 #include "allocator_fit_allocation.h"
 #include "allocator_border_descriptors.h"
+#include "allocator_red_black_tree.h"
+#include "allocator_memory_resource.h"
+#include "allocator_sorted_list_specialized.h"
+#include "allocator_epoch_reclamation.h"
+#include "allocator_buddies_system.h"
+#include "allocator_slab.h"
+#include "allocator_thread_cache.h"
+#include "allocator_cpu_cache.h"
+#include "allocator_hoard.h"
+#include "allocator_sharded.h"
+#include "stl_adapter.h"
 
 class A
 {
@@ -26,6 +43,114 @@ public:
     }
 };
 
+//Замеряет время серии выделений и освобождений блоков от 8 до 255 байт в аллокаторе alc.
+static void benchmark_allocator(
+    allocator* alc,
+    std::string const& allocator_name)
+{
+    constexpr size_t slots_count = 256;
+    constexpr size_t operations_count = 200000;
+    void* slots[slots_count] = {};
+    unsigned int seed = 1;
+
+    auto const started = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < operations_count; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        auto& slot = slots[(seed >> 8) % slots_count];
+
+        if (slot == nullptr)
+        {
+            slot = alc->allocate(8 + (seed >> 16) % 248);
+        }
+        else
+        {
+            alc->deallocate(slot);
+            slot = nullptr;
+        }
+    }
+
+    auto const elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started);
+
+    for (auto* slot : slots)
+    {
+        if (slot != nullptr)
+        {
+            alc->deallocate(slot);
+        }
+    }
+
+    std::cout << allocator_name << ": " << elapsed.count() << " us" << std::endl;
+}
+
+//Замеряет пропускную способность отложенного освобождения: threads_count потоков выделяют узлы и передают их в retire после чтения в критической секции.
+static void benchmark_epoch_reclamation(
+    allocator_epoch_reclamation* alc,
+    size_t threads_count)
+{
+    constexpr size_t retires_per_thread_count = 100000;
+    std::vector<std::thread> threads;
+
+    auto const started = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < threads_count; i++)
+    {
+        threads.emplace_back([alc]()
+        {
+            for (size_t j = 0; j < retires_per_thread_count; j++)
+            {
+                auto* node = alc->allocate(64);
+
+                alc->enter_critical_section();
+                *reinterpret_cast<size_t*>(node) = j;
+                alc->leave_critical_section();
+
+                alc->retire(node);
+            }
+
+            alc->reclaim();
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto const elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started);
+    auto const retires_count = threads_count * retires_per_thread_count;
+
+    std::cout << threads_count << " threads, " << retires_count << " retires: " << elapsed.count() << " us ("
+        << retires_count * 1000 / (elapsed.count() + 1) << " retires per ms)" << std::endl;
+}
+
+//Проверяет, что элементы std::vector и узлы std::map, размещённые через stl_adapter в аллокаторе alc, выровнены по требованиям своих типов.
+static void check_stl_adapter_alignment(
+    allocator* alc,
+    std::string const& allocator_name)
+{
+    using table_value_type = std::pair<int const, double>;
+    bool aligned = true;
+
+    {
+        std::vector<double, stl_adapter<double>> numbers{ stl_adapter<double>(alc) };
+        std::map<int, double, std::less<int>, stl_adapter<table_value_type>> table{ stl_adapter<table_value_type>(alc) };
+
+        for (int i = 0; i < 100; i++)
+        {
+            numbers.push_back(i);
+            aligned = aligned && reinterpret_cast<uintptr_t>(numbers.data()) % alignof(double) == 0;
+
+            auto const& inserted = *table.emplace(i, i).first;
+            aligned = aligned && reinterpret_cast<uintptr_t>(&inserted) % alignof(table_value_type) == 0;
+        }
+    }
+
+    std::cout << allocator_name << ": " << (aligned ? "aligned" : "misaligned") << std::endl;
+    assert(aligned);
+}
+
 int main() {
 
     std::cout << "Allocator - Sorted List:" << std::endl;
@@ -37,6 +162,7 @@ int main() {
     delete builder_3;
 
     allocator* alc_3 = new allocator_sorted_list(10000, nullptr, logger_3, allocator_fit_allocation::allocation_mode::first_fit);
+    // allocator* alc_3 = new allocator_red_black_tree(10000, nullptr, logger_3, allocator_fit_allocation::allocation_mode::the_best_fit);
 
     try
     {
@@ -51,6 +177,10 @@ int main() {
         new (obj) A(13);
         obj->get_value();
 
+        allocator_memory_resource resource(alc_3);
+        std::pmr::vector<int> numbers({ 1, 2, 3 }, &resource);
+        numbers.push_back(4);
+
         // TODO: this is incorrect
         // auto obj_to_copy_from = A(13);
         // std::memcpy(obj, &obj_to_copy_from, sizeof(A));
@@ -76,7 +206,7 @@ int main() {
         ->build();
     delete builder_4;
 
-    allocator* alc2 = new allocator_border_descriptors(1200, alc_3, logger_4, allocator_fit_allocation::allocation_mode::first_fit);
+    allocator* alc2 = new allocator_border_descriptors(300, alc_3, logger_4, allocator_fit_allocation::allocation_mode::first_fit, true);
 
     try
     {
@@ -93,10 +223,70 @@ int main() {
     }
 
     std::cout << std::endl << std::endl;
-    delete alc_3;
     delete alc2;
+    delete alc_3;
     delete logger_4;
 
+    std::cout << "Allocator - STL adapter alignment:" << std::endl;
+    {
+        allocator_sorted_list outer_list(1 << 23);
+        allocator_sorted_list list(1 << 16);
+        allocator_sorted_list nested_list(1 << 16, &outer_list);
+        allocator_border_descriptors descriptors(1 << 20, &outer_list);
+        allocator_red_black_tree tree(1 << 16, &outer_list);
+        allocator_buddies_system buddies(1 << 20, &outer_list);
+        allocator_sorted_list_specialized<first_fit_policy, size_t_block_header_layout> specialized(1 << 16);
+        allocator_slab slab(&descriptors);
+        allocator_thread_cache thread_cache(&tree);
+        allocator_cpu_cache cpu_cache(&buddies);
+        allocator_hoard hoard(2, &descriptors);
+        allocator_sharded sharded(2, 1 << 16, &outer_list);
+
+        check_stl_adapter_alignment(&list, "allocator_sorted_list");
+        check_stl_adapter_alignment(&nested_list, "allocator_sorted_list (nested)");
+        check_stl_adapter_alignment(&descriptors, "allocator_border_descriptors (nested)");
+        check_stl_adapter_alignment(&tree, "allocator_red_black_tree (nested)");
+        check_stl_adapter_alignment(&buddies, "allocator_buddies_system (nested)");
+        check_stl_adapter_alignment(&specialized, "allocator_sorted_list_specialized<first_fit_policy, size_t_block_header_layout>");
+        check_stl_adapter_alignment(&slab, "allocator_slab");
+        check_stl_adapter_alignment(&thread_cache, "allocator_thread_cache");
+        check_stl_adapter_alignment(&cpu_cache, "allocator_cpu_cache");
+        check_stl_adapter_alignment(&hoard, "allocator_hoard");
+        check_stl_adapter_alignment(&sharded, "allocator_sharded");
+    }
+
+    std::cout << std::endl << std::endl;
+
+    std::cout << "Allocator - Sorted List benchmark:" << std::endl;
+    {
+        allocator_sorted_list first_fit_list(1 << 20, nullptr, nullptr, allocator_fit_allocation::allocation_mode::first_fit);
+        allocator_sorted_list best_fit_list(1 << 20, nullptr, nullptr, allocator_fit_allocation::allocation_mode::the_best_fit);
+        allocator_sorted_list_specialized<first_fit_policy, size_t_block_header_layout> first_fit_specialized(1 << 20);
+        allocator_sorted_list_specialized<the_best_fit_policy, size_t_block_header_layout> best_fit_specialized(1 << 20);
+        allocator_sorted_list_specialized<first_fit_policy, compact_block_header_layout> first_fit_compact(1 << 20);
+
+        benchmark_allocator(&first_fit_list, "allocator_sorted_list (first_fit)");
+        benchmark_allocator(&first_fit_specialized, "allocator_sorted_list_specialized<first_fit_policy, size_t_block_header_layout>");
+        benchmark_allocator(&first_fit_compact, "allocator_sorted_list_specialized<first_fit_policy, compact_block_header_layout>");
+        benchmark_allocator(&best_fit_list, "allocator_sorted_list (the_best_fit)");
+        benchmark_allocator(&best_fit_specialized, "allocator_sorted_list_specialized<the_best_fit_policy, size_t_block_header_layout>");
+    }
+
+    std::cout << std::endl << std::endl;
+
+    std::cout << "Allocator - Epoch Reclamation benchmark:" << std::endl;
+    {
+        allocator_sorted_list_specialized<first_fit_policy, size_t_block_header_layout> backing_list(1 << 24);
+
+        for (size_t threads_count : { 1, 2, 4 })
+        {
+            allocator_epoch_reclamation reclamation(&backing_list);
+            benchmark_epoch_reclamation(&reclamation, threads_count);
+        }
+    }
+
+    std::cout << std::endl << std::endl;
+
 
     int x;
     std::cin >> x;
@@ -1,4 +1,7 @@
 #include <sstream>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 #include "not_implemented.h"
 #include "allocator.h"
 
@@ -154,6 +157,62 @@ void allocator::dump_trusted_memory_blocks_state() const
     throw not_implemented("void memory::dump_trusted_memory_blocks_state() const");
 }
 
+void allocator::deallocate(
+    void *block_to_deallocate_address,
+    size_t)
+{
+    deallocate(block_to_deallocate_address);
+}
+
+size_t allocator::get_natural_alignment() const noexcept
+{
+    return alignof(size_t);
+}
+
+void *allocator::allocate_aligned(
+    size_t requested_block_size,
+    size_t alignment)
+{
+    //,       ,    
+    if (alignment <= get_natural_alignment())
+    {
+        return allocate(requested_block_size);
+    }
+
+    throw not_implemented("void *memory::allocate_aligned(size_t, size_t)");
+}
+
+void allocator::allocate_batch(
+    size_t blocks_count,
+    size_t requested_block_size,
+    void **allocated_blocks)
+{
+    size_t allocated_blocks_count = 0;
+
+    try
+    {
+        for (; allocated_blocks_count < blocks_count; ++allocated_blocks_count)
+        {
+            allocated_blocks[allocated_blocks_count] = allocate(requested_block_size);
+        }
+    }
+    catch (...)
+    {
+        deallocate_batch(allocated_blocks, allocated_blocks_count);
+        throw;
+    }
+}
+
+void allocator::deallocate_batch(
+    void **blocks_to_deallocate,
+    size_t blocks_count)
+{
+    for (size_t i = 0; i < blocks_count; ++i)
+    {
+        deallocate(blocks_to_deallocate[i]);
+    }
+}
+
 void *allocator::operator+=(
     size_t requested_block_size)
 {
@@ -177,4 +236,24 @@ std::string allocator::address_to_hex(
     void const * const pointer) noexcept
 {
     return std::string { (std::stringstream() << pointer).str() };
+}
+
+size_t allocator::get_lowest_set_bit_index(
+    unsigned long long bitmap) noexcept
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+#if defined(_WIN64)
+    _BitScanForward64(&index, bitmap);
+#else
+    if (_BitScanForward(&index, static_cast<unsigned long>(bitmap)) == 0)
+    {
+        _BitScanForward(&index, static_cast<unsigned long>(bitmap >> 32));
+        index += 32;
+    }
+#endif
+    return index;
+#else
+    return static_cast<size_t>(__builtin_ctzll(bitmap));
+#endif
 }
\ No newline at end of file
@@ -114,6 +114,10 @@ public:
     virtual void deallocate(
         void *block_to_deallocate_address) = 0;
 
+    virtual void deallocate(
+        void *block_to_deallocate_address,
+        size_t block_size);
+
     [[nodiscard]] virtual void *reallocate(
         void *block_to_reallocate_address,
         size_t new_block_size) = 0;
@@ -122,6 +126,21 @@ public:
         void **block_to_reallocate_address_address,
         size_t new_block_size) = 0;
 
+    [[nodiscard]] virtual size_t get_natural_alignment() const noexcept;
+
+    [[nodiscard]] virtual void *allocate_aligned(
+        size_t requested_block_size,
+        size_t alignment);
+
+    virtual void allocate_batch(
+        size_t blocks_count,
+        size_t requested_block_size,
+        void **allocated_blocks);
+
+    virtual void deallocate_batch(
+        void **blocks_to_deallocate,
+        size_t blocks_count);
+
 public:
 
     void *operator+=(
@@ -141,6 +160,9 @@ protected:
     [[nodiscard]] static std::string address_to_hex(
         void const *pointer) noexcept;
 
+    [[nodiscard]] static size_t get_lowest_set_bit_index(
+        unsigned long long bitmap) noexcept;
+
 };
 
 #endif //DATA_STRUCTURES_CPP_MEMORY_H
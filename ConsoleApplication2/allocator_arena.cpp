@@ -0,0 +1,322 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include "operation_not_supported.h"
+#include "allocator_arena.h"
+
+allocator_arena::allocator_arena(
+    size_t memory_size,
+    allocator *outer_allocator,
+    logger *log)
+{
+    auto got_typename = get_typename();
+
+    if (log != nullptr)
+    {
+        log->trace(got_typename + " allocator instance construction started")
+            ->debug("requested memory size: " + std::to_string(memory_size) + " bytes");
+    }
+
+    auto const minimal_trusted_memory_size = get_chunk_service_block_size() + _block_alignment;
+
+    if (memory_size < minimal_trusted_memory_size)
+    {
+        auto error_message = "trusted memory size should be GT " + std::to_string(minimal_trusted_memory_size) + " bytes";
+
+        if (log != nullptr)
+        {
+            log->error(error_message);
+        }
+
+        throw allocator::memory_exception(error_message);
+    }
+
+    auto const allocator_service_block_size = get_allocator_service_block_size();
+
+    _trusted_memory = outer_allocator == nullptr
+        ? ::operator new(memory_size + allocator_service_block_size)
+        : outer_allocator->allocate(memory_size + allocator_service_block_size);
+
+    auto * const memory_size_space = reinterpret_cast<size_t *>(_trusted_memory);
+    *memory_size_space = memory_size;
+
+    auto * const outer_allocator_pointer_space = reinterpret_cast<allocator **>(memory_size_space + 1);
+    *outer_allocator_pointer_space = outer_allocator;
+
+    auto * const logger_pointer_space = reinterpret_cast<logger **>(outer_allocator_pointer_space + 1);
+    *logger_pointer_space = log;
+
+    new (&get_current_chunk()) std::atomic<void *>(get_initial_chunk_address());
+
+    new (&get_overflow_chunks_mutex()) std::mutex();
+
+    initialize_chunk(get_initial_chunk_address(), memory_size, nullptr);
+
+    this->trace_with_guard(got_typename + " allocator instance construction finished");
+}
+
+allocator_arena::~allocator_arena() noexcept
+{
+    auto got_typename = get_typename();
+    this->trace_with_guard(got_typename + " allocator instance destruction started");
+
+    auto const * const logger = get_logger();
+
+    release_overflow_chunks();
+    get_overflow_chunks_mutex().~mutex();
+
+    deallocate_with_guard(_trusted_memory);
+
+    if (logger != nullptr)
+    {
+        logger->trace(got_typename + " allocator instance destruction finished");
+    }
+}
+
+size_t allocator_arena::get_trusted_memory_size() const noexcept
+{
+    return *reinterpret_cast<size_t *>(_trusted_memory);
+}
+
+size_t allocator_arena::get_allocator_service_block_size() const noexcept
+{
+    auto const memory_size_size = sizeof(size_t);
+    auto const outer_allocator_pointer_size = sizeof(allocator *);
+    auto const logger_pointer_size = sizeof(logger *);
+    auto const current_chunk_pointer_alignment_size = alignof(std::atomic<void *>) - 1;
+    auto const current_chunk_pointer_size = sizeof(std::atomic<void *>);
+    auto const overflow_chunks_mutex_alignment_size = alignof(std::mutex) - 1;
+    auto const overflow_chunks_mutex_size = sizeof(std::mutex);
+
+    return memory_size_size + outer_allocator_pointer_size + logger_pointer_size + current_chunk_pointer_alignment_size + current_chunk_pointer_size + overflow_chunks_mutex_alignment_size + overflow_chunks_mutex_size;
+}
+
+size_t allocator_arena::get_chunk_service_block_size() noexcept
+{
+    auto const chunk_service_block_alignment_size = alignof(std::atomic<size_t>) - 1;
+    auto const chunk_end_pointer_size = sizeof(unsigned char *);
+    auto const next_chunk_pointer_size = sizeof(void *);
+    auto const top_offset_size = sizeof(std::atomic<size_t>);
+
+    return chunk_service_block_alignment_size + chunk_end_pointer_size + next_chunk_pointer_size + top_offset_size;
+}
+
+std::atomic<void *> &allocator_arena::get_current_chunk() const noexcept
+{
+    //        
+    auto const current_chunk_address = reinterpret_cast<uintptr_t>(_trusted_memory) + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *);
+
+    return *reinterpret_cast<std::atomic<void *> *>((current_chunk_address + alignof(std::atomic<void *>) - 1) & ~(alignof(std::atomic<void *>) - 1));
+}
+
+std::mutex &allocator_arena::get_overflow_chunks_mutex() const noexcept
+{
+    auto const overflow_chunks_mutex_address = reinterpret_cast<uintptr_t>(&get_current_chunk() + 1);
+
+    return *reinterpret_cast<std::mutex *>((overflow_chunks_mutex_address + alignof(std::mutex) - 1) & ~(alignof(std::mutex) - 1));
+}
+
+void *allocator_arena::get_initial_chunk_address() const noexcept
+{
+    return reinterpret_cast<unsigned char *>(_trusted_memory) + get_allocator_service_block_size();
+}
+
+unsigned char **allocator_arena::get_chunk_end_address_address(
+    void *chunk) noexcept
+{
+    //   ,        
+    auto const chunk_address = reinterpret_cast<uintptr_t>(chunk);
+
+    return reinterpret_cast<unsigned char **>((chunk_address + alignof(std::atomic<size_t>) - 1) & ~(alignof(std::atomic<size_t>) - 1));
+}
+
+void **allocator_arena::get_chunk_next_chunk_address_address(
+    void *chunk) noexcept
+{
+    return reinterpret_cast<void **>(get_chunk_end_address_address(chunk) + 1);
+}
+
+std::atomic<size_t> &allocator_arena::get_chunk_top_offset(
+    void *chunk) noexcept
+{
+    return *reinterpret_cast<std::atomic<size_t> *>(get_chunk_next_chunk_address_address(chunk) + 1);
+}
+
+void allocator_arena::initialize_chunk(
+    void *chunk,
+    size_t chunk_size,
+    void *next_chunk) noexcept
+{
+    auto * const chunk_begin = reinterpret_cast<unsigned char *>(chunk);
+
+    //    ,      
+    auto const first_block_offset = ((reinterpret_cast<size_t>(chunk_begin) + get_chunk_service_block_size() + _block_alignment - 1) & ~(_block_alignment - 1)) - reinterpret_cast<size_t>(chunk_begin);
+
+    *get_chunk_end_address_address(chunk) = chunk_begin + chunk_size;
+    *get_chunk_next_chunk_address_address(chunk) = next_chunk;
+    new (&get_chunk_top_offset(chunk)) std::atomic<size_t>(first_block_offset);
+}
+
+void allocator_arena::attach_overflow_chunk(
+    void *exhausted_chunk,
+    size_t required_block_size)
+{
+    std::lock_guard<std::mutex> overflow_chunks_lock(get_overflow_chunks_mutex());
+
+    auto &current_chunk = get_current_chunk();
+    if (current_chunk.load(std::memory_order_acquire) != exhausted_chunk)
+    {
+        //     
+        return;
+    }
+
+    auto const minimal_chunk_size = get_chunk_service_block_size() + _block_alignment - 1 + required_block_size;
+    auto * const next_chunk = *get_chunk_next_chunk_address_address(exhausted_chunk);
+
+    //,   reset, ,        
+    if (next_chunk != nullptr)
+    {
+        auto const next_chunk_size = static_cast<size_t>(*get_chunk_end_address_address(next_chunk) - reinterpret_cast<unsigned char *>(next_chunk));
+
+        if (next_chunk_size >= minimal_chunk_size)
+        {
+            initialize_chunk(next_chunk, next_chunk_size, *get_chunk_next_chunk_address_address(next_chunk));
+            current_chunk.store(next_chunk, std::memory_order_release);
+
+            this->trace_with_guard("Reused overflow chunk of " + std::to_string(next_chunk_size) + " bytes at " + address_to_hex(next_chunk));
+
+            return;
+        }
+    }
+
+    auto const chunk_size = std::max(get_trusted_memory_size(), minimal_chunk_size);
+
+    void *overflow_chunk;
+    try
+    {
+        overflow_chunk = allocate_with_guard(chunk_size);
+    }
+    catch (std::exception const &)
+    {
+        auto const warning_message = "no memory available to allocate";
+
+        this->warning_with_guard(warning_message);
+
+        throw memory_exception(warning_message);
+    }
+
+    //       ,      
+    initialize_chunk(overflow_chunk, chunk_size, next_chunk);
+    *get_chunk_next_chunk_address_address(exhausted_chunk) = overflow_chunk;
+    current_chunk.store(overflow_chunk, std::memory_order_release);
+
+    this->trace_with_guard("Attached overflow chunk of " + std::to_string(chunk_size) + " bytes at " + address_to_hex(overflow_chunk));
+}
+
+void allocator_arena::release_overflow_chunks() noexcept
+{
+    auto * const initial_chunk = get_initial_chunk_address();
+    auto *chunk = *get_chunk_next_chunk_address_address(initial_chunk);
+
+    while (chunk != nullptr)
+    {
+        auto * const next_chunk = *get_chunk_next_chunk_address_address(chunk);
+        deallocate_with_guard(chunk);
+        chunk = next_chunk;
+    }
+
+    *get_chunk_next_chunk_address_address(initial_chunk) = nullptr;
+    get_current_chunk().store(initial_chunk, std::memory_order_release);
+}
+
+void *allocator_arena::allocate(
+    size_t requested_block_size)
+{
+    //,   ,          
+    if (requested_block_size > std::numeric_limits<size_t>::max() - get_chunk_service_block_size() - 2 * _block_alignment)
+    {
+        auto const warning_message = "no memory available to allocate";
+
+        this->warning_with_guard(warning_message);
+
+        throw memory_exception(warning_message);
+    }
+
+    auto const required_block_size = requested_block_size == 0
+        ? _block_alignment
+        : (requested_block_size + _block_alignment - 1) & ~(_block_alignment - 1);
+    auto &current_chunk = get_current_chunk();
+
+    while (true)
+    {
+        auto * const chunk = current_chunk.load(std::memory_order_acquire);
+        auto const block_offset = get_chunk_top_offset(chunk).fetch_add(required_block_size, std::memory_order_relaxed);
+        auto * const block = reinterpret_cast<unsigned char *>(chunk) + block_offset;
+
+        //    ,         
+        if (block_offset + required_block_size <= static_cast<size_t>(*get_chunk_end_address_address(chunk) - reinterpret_cast<unsigned char *>(chunk)))
+        {
+            return block;
+        }
+
+        attach_overflow_chunk(chunk, required_block_size);
+    }
+}
+
+void allocator_arena::deallocate(
+    void *)
+{
+
+}
+
+void *allocator_arena::reallocate(
+    void *,
+    size_t)
+{
+    this->error_with_guard("reallocate is not supported by " + get_typename() + ": block sizes are not stored");
+
+    throw operation_not_supported();
+}
+
+bool allocator_arena::reallocate(
+    void **block_to_reallocate_address_address,
+    size_t new_block_size)
+{
+    try {
+        *block_to_reallocate_address_address = reallocate(*block_to_reallocate_address_address, new_block_size);
+        return true;
+    }
+    catch (std::exception const &ex)
+    {
+        this->warning_with_guard(ex.what());
+        return false;
+    }
+}
+
+void allocator_arena::reset() noexcept
+{
+    this->trace_with_guard(get_typename() + "::reset() execution started");
+
+    auto * const initial_chunk = get_initial_chunk_address();
+
+    initialize_chunk(initial_chunk, get_trusted_memory_size(), *get_chunk_next_chunk_address_address(initial_chunk));
+    get_current_chunk().store(initial_chunk, std::memory_order_release);
+
+    this->trace_with_guard(get_typename() + "::reset() execution finished");
+}
+
+logger *allocator_arena::get_logger() const noexcept
+{
+    return *reinterpret_cast<logger **>(reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1) + 1);
+}
+
+std::string allocator_arena::get_typename() const noexcept
+{
+    return "allocator_arena";
+}
+
+allocator *allocator_arena::get_allocator() const noexcept
+{
+    return *reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1);
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_ARENA_H
+#define DATA_STRUCTURES_CPP_MEMORY_WITH_ARENA_H
+
+#include <atomic>
+#include <mutex>
+#include "typename_holder.h"
+#include "logger.h"
+#include "logger_holder.h"
+#include "allocator.h"
+#include "allocator_holder.h"
+
+class allocator_arena final:
+    public allocator,
+    protected logger_holder,
+    protected typename_holder,
+    protected allocator_holder
+{
+
+private:
+
+    //   (    ).
+    static constexpr size_t _block_alignment = 16;
+
+private:
+
+    void *_trusted_memory;
+
+public:
+
+    //    memory_size;          outer_allocator.
+    explicit allocator_arena(
+        size_t memory_size,
+        allocator *outer_allocator = nullptr,
+        logger *logger = nullptr);
+
+    allocator_arena(
+        allocator_arena const &other) = delete;
+
+    allocator_arena &operator=(
+        allocator_arena const &other) = delete;
+
+    // .         .
+    ~allocator_arena() noexcept;
+
+private:
+
+    //    (    ).
+    [[nodiscard]] size_t get_trusted_memory_size() const noexcept override;
+
+    //     .
+    [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override;
+
+    //     .
+    [[nodiscard]] static size_t get_chunk_service_block_size() noexcept;
+
+    //  ,    .
+    [[nodiscard]] std::atomic<void *> &get_current_chunk() const noexcept;
+
+    // ,     .
+    [[nodiscard]] std::mutex &get_overflow_chunks_mutex() const noexcept;
+
+    //   .
+    [[nodiscard]] void *get_initial_chunk_address() const noexcept;
+
+    //   .
+    [[nodiscard]] static unsigned char **get_chunk_end_address_address(
+        void *chunk) noexcept;
+
+    //      (,   reset,      ).
+    [[nodiscard]] static void **get_chunk_next_chunk_address_address(
+        void *chunk) noexcept;
+
+    //      .
+    [[nodiscard]] static std::atomic<size_t> &get_chunk_top_offset(
+        void *chunk) noexcept;
+
+    //   chunk_size   chunk,      next_chunk.
+    static void initialize_chunk(
+        void *chunk,
+        size_t chunk_size,
+        void *next_chunk) noexcept;
+
+    //  ,   exhausted_chunk     required_block_size,      exhausted_chunk.
+    //,     reset,  ;       .
+    void attach_overflow_chunk(
+        void *exhausted_chunk,
+        size_t required_block_size);
+
+    //      .
+    void release_overflow_chunks() noexcept;
+
+public:
+
+    //        .
+    void *allocate(
+        size_t requested_block_size) override;
+
+    using allocator::deallocate;
+
+    //  :      reset.
+    void deallocate(
+        void *block_to_deallocate_address) override;
+
+    // :     .
+    [[nodiscard]] void *reallocate(
+        void *block_to_reallocate_address,
+        size_t new_block_size) override;
+
+    //      .    ,    .
+    bool reallocate(
+        void **block_to_reallocate_address_address,
+        size_t new_block_size) override;
+
+public:
+
+    //     O(1):           .
+    //          ;      .
+    //     allocate.
+    void reset() noexcept;
+
+private:
+
+    //    logger,    .
+    [[nodiscard]] logger *get_logger() const noexcept override;
+
+private:
+
+    //     (allocator_arena).
+    [[nodiscard]] std::string get_typename() const noexcept override;
+
+private:
+
+    //     (  ).
+    [[nodiscard]] allocator *get_allocator() const noexcept override;
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_WITH_ARENA_H
\ No newline at end of file
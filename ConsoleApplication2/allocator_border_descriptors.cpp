@@ -1,10 +1,15 @@
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include "operation_not_supported.h"
 #include "allocator_border_descriptors.h"
 
 allocator_border_descriptors::allocator_border_descriptors(
     size_t memory_size,
     allocator* outer_allocator,
     logger* log,
-    allocator_fit_allocation::allocation_mode allocation_mode)
+    allocator_fit_allocation::allocation_mode allocation_mode,
+    bool growable)
 {
     auto got_typename = get_typename();
 
@@ -28,11 +33,25 @@ allocator_border_descriptors::allocator_border_descriptors(
         throw allocator::memory_exception(error_message);
     }
 
+    if (allocation_mode == allocator_fit_allocation::allocation_mode::segregated_fit)
+    {
+        if (log != nullptr)
+        {
+            log->error("segregated fit allocation mode is not supported by " + got_typename);
+        }
+
+        throw operation_not_supported();
+    }
+
+    //   sizeof(size_t),         
+    memory_size &= ~(sizeof(size_t) - 1);
+
     auto const allocator_service_block_size = get_allocator_service_block_size();
 
+    //     (   ),   -     
     _trusted_memory = outer_allocator == nullptr
-        ? ::operator new(memory_size + allocator_service_block_size)
-        : outer_allocator->allocate(memory_size + allocator_service_block_size);
+        ? ::operator new(memory_size + allocator_service_block_size + sizeof(size_t) + sizeof(size_t) - 1)
+        : outer_allocator->allocate(memory_size + allocator_service_block_size + sizeof(size_t) + sizeof(size_t) - 1);
 
     auto* const memory_size_space = reinterpret_cast<size_t*>(_trusted_memory);
     *memory_size_space = memory_size;
@@ -47,13 +66,27 @@ allocator_border_descriptors::allocator_border_descriptors(
     *allocation_mode_space = allocation_mode;
 
     auto* const first_available_block_pointer_space = reinterpret_cast<void**>(allocation_mode_space + 1);
-    *first_available_block_pointer_space = reinterpret_cast<void*>(first_available_block_pointer_space + 1);
+    *first_available_block_pointer_space = nullptr;
+
+    auto* const first_extra_segment_pointer_space = first_available_block_pointer_space + 1;
+    *first_extra_segment_pointer_space = nullptr;
 
-    auto* const first_available_block_size_space = reinterpret_cast<size_t*>(*first_available_block_pointer_space);
-    *first_available_block_size_space = memory_size;
+    auto* const growable_space = reinterpret_cast<size_t*>(first_extra_segment_pointer_space + 1);
+    *growable_space = growable ? 1 : 0;
 
-    auto* const first_available_block_next_block_address_space = reinterpret_cast<void**>(first_available_block_size_space + 1);
-    *first_available_block_next_block_address_space = nullptr;
+    auto* const default_alignment_space = growable_space + 1;
+    *default_alignment_space = sizeof(size_t);
+
+    auto* const next_fit_rover_pointer_space = reinterpret_cast<void**>(default_alignment_space + 1);
+    *next_fit_rover_pointer_space = nullptr;
+
+    //           
+    auto* const first_block = get_first_block_address();
+    *(reinterpret_cast<size_t*>(first_block) - 1) = _block_occupied_flag;
+    *reinterpret_cast<size_t*>(first_block + memory_size) = _block_occupied_flag;
+
+    write_block_tags(first_block, memory_size, false);
+    insert_available_block(first_block);
 
     this->trace_with_guard(got_typename + " allocator instance construction finished");
 }
@@ -65,6 +98,14 @@ allocator_border_descriptors::~allocator_border_descriptors() noexcept
 
     auto const* const logger = get_logger();
 
+    auto* current_extra_segment = *get_first_extra_segment_address_address();
+    while (current_extra_segment != nullptr)
+    {
+        auto* const next_extra_segment = *reinterpret_cast<void**>(reinterpret_cast<size_t*>(current_extra_segment) + 1);
+        deallocate_with_guard(current_extra_segment);
+        current_extra_segment = next_extra_segment;
+    }
+
     deallocate_with_guard(_trusted_memory);
 
     if (logger != nullptr)
@@ -90,23 +131,32 @@ size_t allocator_border_descriptors::get_allocator_service_block_size() const no
     auto const logger_pointer_size = sizeof(logger*);
     auto const allocation_mode_size = sizeof(allocator_fit_allocation::allocation_mode);
     auto const first_available_block_pointer_size = sizeof(void*);
-
-    return memory_size_size + outer_allocator_pointer_size + logger_pointer_size + allocation_mode_size + first_available_block_pointer_size;
+    auto const first_extra_segment_pointer_size = sizeof(void*);
+    auto const growable_size = sizeof(size_t);
+    auto const default_alignment_size = sizeof(size_t);
+    auto const next_fit_rover_pointer_size = sizeof(void*);
+    auto const first_block_leading_fence_size = sizeof(size_t);
+
+    return memory_size_size + outer_allocator_pointer_size + logger_pointer_size + allocation_mode_size + first_available_block_pointer_size +
+        first_extra_segment_pointer_size + growable_size + default_alignment_size + next_fit_rover_pointer_size + first_block_leading_fence_size;
 }
 
 size_t allocator_border_descriptors::get_available_block_service_block_size() const noexcept
 {
-    auto const current_block_size = sizeof(size_t);
+    auto const current_block_size_and_occupancy = sizeof(size_t);
+    auto const previous_available_block_pointer_size = sizeof(void*);
     auto const next_available_block_pointer_size = sizeof(void*);
+    auto const boundary_tag_size = sizeof(size_t);
 
-    return current_block_size + next_available_block_pointer_size;
+    return current_block_size_and_occupancy + previous_available_block_pointer_size + next_available_block_pointer_size + boundary_tag_size;
 }
 
 size_t allocator_border_descriptors::get_occupied_block_service_block_size() const noexcept
 {
-    auto const current_block_size = sizeof(size_t);
+    auto const current_block_size_and_occupancy = sizeof(size_t);
+    auto const boundary_tag_size = sizeof(size_t);
 
-    return current_block_size;
+    return current_block_size_and_occupancy + boundary_tag_size;
 }
 
 void** allocator_border_descriptors::get_first_available_block_address_address() const noexcept
@@ -119,19 +169,270 @@ void* allocator_border_descriptors::get_first_available_block_address() const no
     return *get_first_available_block_address_address();
 }
 
+unsigned char* allocator_border_descriptors::get_first_block_address() const noexcept
+{
+    return get_aligned_block_address(reinterpret_cast<unsigned char*>(_trusted_memory) + get_allocator_service_block_size());
+}
+
+void** allocator_border_descriptors::get_first_extra_segment_address_address() const noexcept
+{
+    return get_first_available_block_address_address() + 1;
+}
+
+bool allocator_border_descriptors::is_growable() const noexcept
+{
+    return *reinterpret_cast<size_t*>(get_first_extra_segment_address_address() + 1) != 0;
+}
+
+size_t allocator_border_descriptors::get_default_alignment() const noexcept
+{
+    return *(reinterpret_cast<size_t*>(get_first_extra_segment_address_address() + 1) + 1);
+}
+
+void** allocator_border_descriptors::get_next_fit_rover_address_address() const noexcept
+{
+    return reinterpret_cast<void**>(reinterpret_cast<size_t*>(get_first_extra_segment_address_address() + 1) + 2);
+}
+
+size_t allocator_border_descriptors::get_available_block_aligned_block_offset(
+    void const* block_address,
+    size_t alignment) const noexcept
+{
+    auto const payload_address = reinterpret_cast<uintptr_t>(block_address) + sizeof(size_t);
+    auto block_offset = static_cast<size_t>((alignment - payload_address % alignment) % alignment);
+
+    //          ,   
+    while (block_offset != 0 && block_offset < get_available_block_service_block_size())
+    {
+        block_offset += alignment;
+    }
+
+    return block_offset;
+}
+
+unsigned char* allocator_border_descriptors::get_aligned_block_address(
+    void* address) noexcept
+{
+    auto const block_address = reinterpret_cast<uintptr_t>(address);
+
+    return reinterpret_cast<unsigned char*>((block_address + sizeof(size_t) - 1) & ~static_cast<uintptr_t>(sizeof(size_t) - 1));
+}
+
+unsigned char* allocator_border_descriptors::get_extra_segment_first_block_address(
+    void* segment_address) const noexcept
+{
+    //      ,       
+    return get_aligned_block_address(reinterpret_cast<unsigned char*>(segment_address) + sizeof(size_t) + sizeof(void*) + sizeof(size_t));
+}
+
+size_t allocator_border_descriptors::get_extra_segment_service_block_size() const noexcept
+{
+    auto const segment_size_size = sizeof(size_t);
+    auto const next_segment_pointer_size = sizeof(void*);
+    auto const first_block_leading_fence_size = sizeof(size_t);
+    auto const last_block_trailing_fence_size = sizeof(size_t);
+
+    return segment_size_size + next_segment_pointer_size + first_block_leading_fence_size + last_block_trailing_fence_size;
+}
+
+void allocator_border_descriptors::attach_extra_segment(
+    size_t required_block_size)
+{
+    auto** const first_extra_segment_address_address = get_first_extra_segment_address_address();
+    auto const last_segment_size = *first_extra_segment_address_address == nullptr
+        ? get_trusted_memory_size()
+        : *reinterpret_cast<size_t*>(*first_extra_segment_address_address);
+
+    //  ,        
+    auto segment_size = last_segment_size << 1;
+    if (segment_size < required_block_size)
+    {
+        segment_size = required_block_size;
+    }
+
+    this->debug_with_guard("Attaching extra segment of " + std::to_string(segment_size) + " bytes");
+
+    auto* const segment = allocate_with_guard(segment_size + get_extra_segment_service_block_size() + sizeof(size_t) - 1);
+
+    auto* const segment_size_space = reinterpret_cast<size_t*>(segment);
+    *segment_size_space = segment_size;
+
+    auto* const next_segment_pointer_space = reinterpret_cast<void**>(segment_size_space + 1);
+    *next_segment_pointer_space = *first_extra_segment_address_address;
+    *first_extra_segment_address_address = segment;
+
+    auto* const first_block = get_extra_segment_first_block_address(segment);
+    *(reinterpret_cast<size_t*>(first_block) - 1) = _block_occupied_flag;
+    *reinterpret_cast<size_t*>(first_block + segment_size) = _block_occupied_flag;
+
+    write_block_tags(first_block, segment_size, false);
+    insert_available_block(first_block);
+}
+
+void allocator_border_descriptors::release_extra_segment_if_available(
+    void* available_block_address)
+{
+    //    ,      -  
+    if (*(reinterpret_cast<size_t const*>(available_block_address) - 1) != _block_occupied_flag ||
+        *reinterpret_cast<size_t const*>(reinterpret_cast<unsigned char const*>(available_block_address) + get_available_block_size(available_block_address)) != _block_occupied_flag)
+    {
+        return;
+    }
+
+    void* previous_segment = nullptr;
+    auto* current_segment = *get_first_extra_segment_address_address();
+
+    while (current_segment != nullptr && get_extra_segment_first_block_address(current_segment) != available_block_address)
+    {
+        previous_segment = current_segment;
+        current_segment = *reinterpret_cast<void**>(reinterpret_cast<size_t*>(current_segment) + 1);
+    }
+
+    if (current_segment == nullptr)
+    {
+        return;
+    }
+
+    remove_available_block(available_block_address);
+
+    auto* const next_segment = *reinterpret_cast<void**>(reinterpret_cast<size_t*>(current_segment) + 1);
+    previous_segment == nullptr
+        ? *get_first_extra_segment_address_address() = next_segment
+        : *reinterpret_cast<void**>(reinterpret_cast<size_t*>(previous_segment) + 1) = next_segment;
+
+    this->debug_with_guard("Releasing extra segment of " + std::to_string(*reinterpret_cast<size_t*>(current_segment)) + " bytes");
+
+    deallocate_with_guard(current_segment);
+}
+
+bool allocator_border_descriptors::get_block_occupancy(void const* block_pointer) const
+{
+    return (*reinterpret_cast<size_t const*>(block_pointer) & _block_occupied_flag) != 0;
+}
+
 size_t allocator_border_descriptors::get_available_block_size(void const* current_block_address) const
 {
-    return *reinterpret_cast<size_t const*>(current_block_address);
+    return *reinterpret_cast<size_t const*>(current_block_address) & ~_block_occupied_flag;
 }
 
-void* allocator_border_descriptors::get_available_block_next_available_block_address(void const* current_block_address) const
+void* allocator_border_descriptors::get_available_block_previous_available_block_address(void const* current_block_address) const
 {
     return *reinterpret_cast<void* const*>(reinterpret_cast<size_t const*>(current_block_address) + 1);
 }
 
+void* allocator_border_descriptors::get_available_block_next_available_block_address(void const* current_block_address) const
+{
+    return *(reinterpret_cast<void* const*>(reinterpret_cast<size_t const*>(current_block_address) + 1) + 1);
+}
+
 size_t allocator_border_descriptors::get_occupied_block_size(void const* current_block_address) const
 {
-    return *reinterpret_cast<size_t const*>(current_block_address);
+    return *reinterpret_cast<size_t const*>(current_block_address) & ~_block_occupied_flag;
+}
+
+void* allocator_border_descriptors::get_available_block_previous_block_address(void const* current_block_address) const
+{
+    return get_occupied_block_previous_block_address(current_block_address);
+}
+
+void* allocator_border_descriptors::get_available_block_next_block_address(void const* current_block_address) const
+{
+    return get_occupied_block_next_block_address(current_block_address);
+}
+
+void* allocator_border_descriptors::get_occupied_block_previous_block_address(void const* current_block_address) const
+{
+    //        ;   -  
+    auto const previous_block_size = *(reinterpret_cast<size_t const*>(current_block_address) - 1) & ~_block_occupied_flag;
+
+    if (previous_block_size == 0)
+    {
+        return nullptr;
+    }
+
+    return const_cast<unsigned char*>(reinterpret_cast<unsigned char const*>(current_block_address) - previous_block_size);
+}
+
+void* allocator_border_descriptors::get_occupied_block_next_block_address(void const* current_block_address) const
+{
+    auto* const next_block = const_cast<unsigned char*>(reinterpret_cast<unsigned char const*>(current_block_address) + get_occupied_block_size(current_block_address));
+
+    return get_occupied_block_size(next_block) != 0
+        ? next_block
+        : nullptr;
+}
+
+void allocator_border_descriptors::write_block_tags(void* block_address, size_t block_size, bool occupied) const noexcept
+{
+    auto const block_size_and_occupancy = occupied
+        ? block_size | _block_occupied_flag
+        : block_size;
+
+    *reinterpret_cast<size_t*>(block_address) = block_size_and_occupancy;
+    *reinterpret_cast<size_t*>(reinterpret_cast<unsigned char*>(block_address) + block_size - sizeof(size_t)) = block_size_and_occupancy;
+}
+
+void allocator_border_descriptors::insert_available_block(void* block_address)
+{
+    auto* const first_available_block = get_first_available_block_address();
+    auto** const previous_available_block_address_space = reinterpret_cast<void**>(reinterpret_cast<size_t*>(block_address) + 1);
+
+    *previous_available_block_address_space = nullptr;
+    *(previous_available_block_address_space + 1) = first_available_block;
+
+    if (first_available_block != nullptr)
+    {
+        *reinterpret_cast<void**>(reinterpret_cast<size_t*>(first_available_block) + 1) = block_address;
+    }
+
+    *get_first_available_block_address_address() = block_address;
+}
+
+void allocator_border_descriptors::remove_available_block(void* block_address)
+{
+    auto* const previous_available_block = get_available_block_previous_available_block_address(block_address);
+    auto* const next_available_block = get_available_block_next_available_block_address(block_address);
+
+    previous_available_block == nullptr
+        ? *get_first_available_block_address_address() = next_available_block
+        : *(reinterpret_cast<void**>(reinterpret_cast<size_t*>(previous_available_block) + 1) + 1) = next_available_block;
+
+    if (next_available_block != nullptr)
+    {
+        *reinterpret_cast<void**>(reinterpret_cast<size_t*>(next_available_block) + 1) = previous_available_block;
+    }
+
+    //  next_fit       ,     
+    auto** const next_fit_rover_address_address = get_next_fit_rover_address_address();
+    if (*next_fit_rover_address_address == block_address)
+    {
+        *next_fit_rover_address_address = next_available_block;
+    }
+}
+
+void allocator_border_descriptors::replace_available_block(void* block_address, void* replacement_block_address)
+{
+    auto* const previous_available_block = get_available_block_previous_available_block_address(block_address);
+    auto* const next_available_block = get_available_block_next_available_block_address(block_address);
+    auto** const previous_available_block_address_space = reinterpret_cast<void**>(reinterpret_cast<size_t*>(replacement_block_address) + 1);
+
+    *previous_available_block_address_space = previous_available_block;
+    *(previous_available_block_address_space + 1) = next_available_block;
+
+    previous_available_block == nullptr
+        ? *get_first_available_block_address_address() = replacement_block_address
+        : *(reinterpret_cast<void**>(reinterpret_cast<size_t*>(previous_available_block) + 1) + 1) = replacement_block_address;
+
+    if (next_available_block != nullptr)
+    {
+        *reinterpret_cast<void**>(reinterpret_cast<size_t*>(next_available_block) + 1) = replacement_block_address;
+    }
+
+    auto** const next_fit_rover_address_address = get_next_fit_rover_address_address();
+    if (*next_fit_rover_address_address == block_address)
+    {
+        *next_fit_rover_address_address = replacement_block_address;
+    }
 }
 
 void allocator_border_descriptors::dump_trusted_memory_blocks_state() const
@@ -142,28 +443,29 @@ void allocator_border_descriptors::dump_trusted_memory_blocks_state() const
     }
 
     std::string to_dump("|");
-    auto memory_size = get_trusted_memory_size();
-    auto current_available_block = get_first_available_block_address();
-    unsigned char* first_block = reinterpret_cast<unsigned char*>(_trusted_memory) + get_allocator_service_block_size();
-    unsigned char* current_block = first_block;
+    void* current_block = get_first_block_address();
+    auto* current_extra_segment = *get_first_extra_segment_address_address();
 
-    while (current_block - first_block < memory_size)
+    while (true)
     {
-        size_t current_block_size;
-        if (current_block == current_available_block)
+        while (current_block != nullptr)
         {
-            current_block_size = get_available_block_size(current_block);
-            to_dump += "avl ";
-            current_available_block = get_available_block_next_available_block_address(current_available_block);
+            to_dump += get_block_occupancy(current_block)
+                ? "occ "
+                : "avl ";
+
+            to_dump += std::to_string(get_occupied_block_size(current_block)) + "|";
+            current_block = get_occupied_block_next_block_address(current_block);
         }
-        else
+
+        if (current_extra_segment == nullptr)
         {
-            current_block_size = get_occupied_block_size(current_block);
-            to_dump += "occ ";
+            break;
         }
 
-        to_dump += std::to_string(current_block_size) + "|";
-        current_block += current_block_size;
+        current_block = get_extra_segment_first_block_address(current_extra_segment);
+        current_extra_segment = *reinterpret_cast<void**>(reinterpret_cast<size_t*>(current_extra_segment) + 1);
+        to_dump += "|";
     }
 
     this->debug_with_guard("Memory state: " + to_dump);
@@ -171,46 +473,79 @@ void allocator_border_descriptors::dump_trusted_memory_blocks_state() const
 
 void* allocator_border_descriptors::allocate(size_t requested_block_size)
 {
+    if (get_default_alignment() != sizeof(size_t))
+    {
+        return allocate_aligned(requested_block_size, get_default_alignment());
+    }
+
     auto const got_typename = get_typename();
     this->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution started")
         ->debug_with_guard("Requested " + std::to_string(requested_block_size) + " bytes of memory");
 
-    auto requested_block_size_overridden = requested_block_size;
-    if (requested_block_size_overridden < sizeof(void*))
-    {
-        requested_block_size_overridden = sizeof(void*);
-    }
-
-    void* previous_block = nullptr, * current_block = get_first_available_block_address();
-    void* target_block = nullptr, * previous_to_target_block = nullptr, * next_to_target_block = nullptr;
     auto const available_block_service_block_size = get_available_block_service_block_size();
     auto const occupied_block_service_block_size = get_occupied_block_service_block_size();
     auto const allocation_mode = get_allocation_mode();
 
-    while (current_block != nullptr)
+    auto required_block_size = (requested_block_size + occupied_block_service_block_size + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1);
+    if (required_block_size < available_block_service_block_size)
+    {
+        required_block_size = available_block_service_block_size;
+    }
+
+    //  next_fit       ,      
+    auto* const next_fit_rover = allocation_mode == allocator_fit_allocation::allocation_mode::next_fit
+        ? *get_next_fit_rover_address_address()
+        : nullptr;
+    auto search_wrapped = next_fit_rover == nullptr;
+
+    void* current_block = next_fit_rover == nullptr
+        ? get_first_available_block_address()
+        : next_fit_rover;
+    void* target_block = nullptr;
+
+    while (current_block != nullptr || !search_wrapped)
     {
+        if (current_block == nullptr)
+        {
+            current_block = get_first_available_block_address();
+            search_wrapped = true;
+            continue;
+        }
+
+        if (search_wrapped && current_block == next_fit_rover)
+        {
+            break;
+        }
+
         auto const current_block_size = get_available_block_size(current_block);
-        auto const next_block = get_available_block_next_available_block_address(current_block);
 
-        if (current_block_size >= requested_block_size_overridden + occupied_block_service_block_size)
+        if (current_block_size >= required_block_size)
         {
             if (allocation_mode == allocator_fit_allocation::allocation_mode::first_fit ||
+                allocation_mode == allocator_fit_allocation::allocation_mode::next_fit ||
                 allocation_mode == allocator_fit_allocation::allocation_mode::the_best_fit && (target_block == nullptr || current_block_size < get_available_block_size(target_block)) ||
                 allocation_mode == allocator_fit_allocation::allocation_mode::the_worst_fit && (target_block == nullptr || current_block_size > get_available_block_size(target_block)))
             {
-                previous_to_target_block = previous_block;
                 target_block = current_block;
-                next_to_target_block = next_block;
             }
 
-            if (allocation_mode == allocator_fit_allocation::allocation_mode::first_fit)
+            if (allocation_mode == allocator_fit_allocation::allocation_mode::first_fit ||
+                allocation_mode == allocator_fit_allocation::allocation_mode::next_fit)
             {
                 break;
             }
         }
 
-        previous_block = current_block;
-        current_block = next_block;
+        current_block = get_available_block_next_available_block_address(current_block);
+    }
+
+    if (target_block == nullptr && is_growable())
+    {
+        attach_extra_segment(required_block_size);
+
+        this->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution finished");
+
+        return allocate(requested_block_size);
     }
 
     if (target_block == nullptr)
@@ -224,43 +559,37 @@ void* allocator_border_descriptors::allocate(size_t requested_block_size)
     }
 
     auto const target_block_size = get_available_block_size(target_block);
+    void* next_fit_rover_successor;
 
-    if (target_block_size - requested_block_size_overridden - occupied_block_service_block_size < available_block_service_block_size)
+    if (target_block_size - required_block_size < available_block_service_block_size)
     {
-        requested_block_size_overridden = target_block_size - occupied_block_service_block_size;
+        required_block_size = target_block_size;
+        next_fit_rover_successor = get_available_block_next_available_block_address(target_block);
+        remove_available_block(target_block);
     }
-
-    if (requested_block_size_overridden != requested_block_size)
+    else
     {
-        this->trace_with_guard("Requested " + std::to_string(requested_block_size) + " bytes, but reserved " + std::to_string(requested_block_size_overridden) + " bytes in according to correct work of allocator");
-
-        requested_block_size = requested_block_size_overridden;
+        //     ,     next_fit     
+        auto* const target_block_leftover = reinterpret_cast<unsigned char*>(target_block) + required_block_size;
+        write_block_tags(target_block_leftover, target_block_size - required_block_size, false);
+        replace_available_block(target_block, target_block_leftover);
+        next_fit_rover_successor = target_block_leftover;
     }
 
-    void* updated_next_block_to_previous_block;
-
-    if (requested_block_size == target_block_size - occupied_block_service_block_size)
+    //    next_fit      (    )
+    if (allocation_mode == allocator_fit_allocation::allocation_mode::next_fit)
     {
-        updated_next_block_to_previous_block = next_to_target_block;
+        *get_next_fit_rover_address_address() = next_fit_rover_successor;
     }
-    else
-    {
-        updated_next_block_to_previous_block = reinterpret_cast<void*>(reinterpret_cast<unsigned char*>(target_block) + occupied_block_service_block_size + requested_block_size);
-
-        auto* const target_block_leftover_size = reinterpret_cast<size_t*>(updated_next_block_to_previous_block);
-        *target_block_leftover_size = target_block_size - occupied_block_service_block_size - requested_block_size;
 
-        auto* const target_block_leftover_next_block_address = reinterpret_cast<void**>(target_block_leftover_size + 1);
-        *target_block_leftover_next_block_address = next_to_target_block;
+    if (required_block_size - occupied_block_service_block_size != requested_block_size)
+    {
+        this->trace_with_guard("Requested " + std::to_string(requested_block_size) + " bytes, but reserved " + std::to_string(required_block_size - occupied_block_service_block_size) + " bytes in according to correct work of allocator");
     }
 
-    previous_to_target_block == nullptr
-        ? *get_first_available_block_address_address() = updated_next_block_to_previous_block
-        : *reinterpret_cast<void**>(reinterpret_cast<size_t*>(previous_to_target_block) + 1) = updated_next_block_to_previous_block;
+    write_block_tags(target_block, required_block_size, true);
 
     auto* target_block_size_address = reinterpret_cast<size_t*>(target_block);
-    *target_block_size_address = requested_block_size + sizeof(size_t);
-
     auto* const allocated_block = reinterpret_cast<void*>(target_block_size_address + 1);
 
     this->trace_with_guard("Allocated block placed at " + address_to_hex(allocated_block))
@@ -272,128 +601,179 @@ void* allocator_border_descriptors::allocate(size_t requested_block_size)
     return allocated_block;
 }
 
-void allocator_border_descriptors::deallocate(void* block_to_deallocate_address)
+void* allocator_border_descriptors::allocate_aligned(size_t requested_block_size, size_t alignment)
 {
     auto const got_typename = get_typename();
-    this->trace_with_guard(got_typename + "::deallocate(void *block_to_deallocate_address) execution started");
 
-    //     ,   ,   .
-    auto* before_the_block_to_deallocate_size = reinterpret_cast<size_t*>(block_to_deallocate_address) - 1;
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+    {
+        auto const error_message = "alignment should be a power of two";
 
-    //
-    size_t block_size = *before_the_block_to_deallocate_size;
+        this->error_with_guard(error_message);
 
-    //  char*,      1 .       
-    //auto* previous_block_descriptor = reinterpret_cast<size_t*>(reinterpret_cast<char*>(block_to_deallocate_address) - sizeof(size_t)); //   
-    //auto* next_block_descriptor = reinterpret_cast<size_t*>(reinterpret_cast<char*>(block_to_deallocate_address) + block_size);//   
+        throw std::invalid_argument(error_message);
+    }
 
-    //   
-    void** next_block = reinterpret_cast<void**>(reinterpret_cast<size_t*>(block_to_deallocate_address) + 1);
+    if (alignment < get_default_alignment())
+    {
+        alignment = get_default_alignment();
+    }
 
-    //   
-    void* previous_block = nullptr;
-    auto* current_block = get_first_available_block_address();
+    //       sizeof(size_t)
+    if (alignment <= sizeof(size_t))
+    {
+        return allocate(requested_block_size);
+    }
 
-    while (current_block < block_to_deallocate_address && current_block != nullptr) {
+    this->trace_with_guard("Method `void *" + got_typename + "::allocate_aligned(size_t requested_block_size, size_t alignment)` execution started")
+        ->debug_with_guard("Requested " + std::to_string(requested_block_size) + " bytes of memory aligned by " + std::to_string(alignment) + " bytes");
 
-        previous_block = current_block;
-        current_block = get_available_block_next_available_block_address(current_block);
+    auto const available_block_service_block_size = get_available_block_service_block_size();
+    auto const occupied_block_service_block_size = get_occupied_block_service_block_size();
+
+    //     ,   alignment    
+    if (alignment > (std::numeric_limits<size_t>::max() - occupied_block_service_block_size - available_block_service_block_size) / 2 ||
+        requested_block_size > std::numeric_limits<size_t>::max() - occupied_block_service_block_size - available_block_service_block_size - (alignment << 1))
+    {
+        auto const warning_message = "no memory available to allocate";
 
-        /*size_t current_block_size = *reinterpret_cast<size_t*>(current_block);
-        previous_block = current_block;
+        this->warning_with_guard(warning_message)
+            ->trace_with_guard("Method `void *" + got_typename + "::allocate_aligned(size_t requested_block_size, size_t alignment)` execution finished");
 
-        current_block = reinterpret_cast<void*>(reinterpret_cast<size_t*>(current_block) + current_block_size);*/
+        throw memory_exception(warning_message);
     }
 
+    auto const allocation_mode = get_allocation_mode();
 
-    if (previous_block == nullptr) {
-        *get_first_available_block_address_address() = block_to_deallocate_address;
-    }
-    else {
-        *reinterpret_cast<void**>(reinterpret_cast<size_t*>(previous_block) + 1) = block_to_deallocate_address;
+    auto required_block_size = requested_block_size + occupied_block_service_block_size;
+    if (required_block_size < available_block_service_block_size)
+    {
+        required_block_size = available_block_service_block_size;
     }
 
+    //     :         
+    required_block_size = (required_block_size + alignment - 1) & ~(alignment - 1);
 
-    //     
-    if (current_block == nullptr) {
-        *before_the_block_to_deallocate_size = block_size;
-        *next_block = nullptr;
-    }
-    else {
-        size_t new_block_size = block_size + static_cast<size_t>((reinterpret_cast<unsigned char*>(current_block) - reinterpret_cast<unsigned char*>(block_to_deallocate_address)));
-        *before_the_block_to_deallocate_size = new_block_size;
-        *next_block = reinterpret_cast<void*>(reinterpret_cast<size_t*>(block_to_deallocate_address) + 1 + new_block_size / sizeof(size_t));
-    }
+    void* current_block = get_first_available_block_address();
+    void* target_block = nullptr;
+    size_t target_block_offset = 0;
 
+    while (current_block != nullptr)
+    {
+        auto const current_block_size = get_available_block_size(current_block);
+        auto const current_block_offset = get_available_block_aligned_block_offset(current_block, alignment);
 
+        if (current_block_offset + required_block_size <= current_block_size)
+        {
+            if (allocation_mode == allocator_fit_allocation::allocation_mode::first_fit ||
+                allocation_mode == allocator_fit_allocation::allocation_mode::next_fit ||
+                (allocation_mode == allocator_fit_allocation::allocation_mode::the_best_fit && (target_block == nullptr || current_block_size < get_available_block_size(target_block))) ||
+                (allocation_mode == allocator_fit_allocation::allocation_mode::the_worst_fit && (target_block == nullptr || current_block_size > get_available_block_size(target_block))))
+            {
+                target_block = current_block;
+                target_block_offset = current_block_offset;
+            }
 
+            if (allocation_mode == allocator_fit_allocation::allocation_mode::first_fit ||
+                allocation_mode == allocator_fit_allocation::allocation_mode::next_fit)
+            {
+                break;
+            }
+        }
 
+        current_block = get_available_block_next_available_block_address(current_block);
+    }
 
+    if (target_block == nullptr && is_growable())
+    {
+        //    alignment +    
+        attach_extra_segment(required_block_size + alignment + available_block_service_block_size);
 
+        this->trace_with_guard("Method `void *" + got_typename + "::allocate_aligned(size_t requested_block_size, size_t alignment)` execution finished");
 
+        return allocate_aligned(requested_block_size, alignment);
+    }
 
-    //if (previous_block == nullptr) {
-    //    *get_first_available_block_address_address() = block_to_deallocate_address;
-    //}
-    //else {
-    //    *reinterpret_cast<void**>(reinterpret_cast<size_t*>(previous_block) + 1) = block_to_deallocate_address;
-    //}
+    if (target_block == nullptr)
+    {
+        auto const warning_message = "no memory available to allocate";
 
-    //if (current_block == nullptr) {
+        this->warning_with_guard(warning_message)
+            ->trace_with_guard("Method `void *" + got_typename + "::allocate_aligned(size_t requested_block_size, size_t alignment)` execution finished");
 
-    //    /*size_t new_size = *reinterpret_cast<size_t*>(previous_block) + block_size;
-    //    *reinterpret_cast<size_t*>(previous_block) = new_size;
+        throw memory_exception(warning_message);
+    }
+
+    remove_available_block(target_block);
 
-    //    void* next_block_after_merge = reinterpret_cast<void*>(reinterpret_cast<size_t*>(previous_block) + new_size);*/
-    //    *before_the_block_to_deallocate_size = block_size;
-    //    *next_block = nullptr;
-    //}
-    //else {
-    //    size_t new_size = reinterpret_cast<size_t>(current_block) + block_size;
-    //    *before_the_block_to_deallocate_size = new_size;
+    auto const target_block_size = get_available_block_size(target_block);
 
-    //    *next_block = reinterpret_cast<void*>(reinterpret_cast<size_t*>(block_to_deallocate_address) + new_size);
-    //}
+    //           
+    if (target_block_offset != 0)
+    {
+        write_block_tags(target_block, target_block_offset, false);
+        insert_available_block(target_block);
+    }
 
+    auto* const block_address = reinterpret_cast<unsigned char*>(target_block) + target_block_offset;
+    auto block_size = target_block_size - target_block_offset;
 
+    if (block_size - required_block_size >= available_block_service_block_size)
+    {
+        write_block_tags(block_address + required_block_size, block_size - required_block_size, false);
+        insert_available_block(block_address + required_block_size);
+        block_size = required_block_size;
+    }
 
+    write_block_tags(block_address, block_size, true);
 
+    auto* const allocated_block = reinterpret_cast<void*>(reinterpret_cast<size_t*>(block_address) + 1);
 
-    ////  /
-    //bool previous_block_free = (*previous_block_descriptor & 1) == 0;
-    //bool next_block_free = (*next_block_descriptor & 1) == 0;
+    this->trace_with_guard("Allocated block placed at " + address_to_hex(allocated_block))
+        ->trace_with_guard("Method `void *" + got_typename + "::allocate_aligned(size_t requested_block_size, size_t alignment)` execution finished");
 
-    ////   
-    //*before_the_block_to_deallocate_size = block_size;
+    this->debug_with_guard("After `allocate_aligned` for " + std::to_string(requested_block_size) + " bytes (addr == " +
+        address_to_hex(block_address) + "):");
+    dump_trusted_memory_blocks_state();
+    return allocated_block;
+}
 
-    //if (previous_block_free && next_block_free) {
-    //    //      
-    //    size_t prev_block_size = *(previous_block_descriptor - 1);
-    //    size_t next_block_size = *next_block_descriptor;
+void allocator_border_descriptors::deallocate(void* block_to_deallocate_address)
+{
+    auto const got_typename = get_typename();
+    this->trace_with_guard(got_typename + "::deallocate(void *block_to_deallocate_address) execution started");
 
-    //    //
-    //    *previous_block_descriptor = prev_block_size + block_size + next_block_size + 2 * sizeof(size_t);
+    block_to_deallocate_address = reinterpret_cast<void*>(reinterpret_cast<size_t*>(block_to_deallocate_address) - 1);
 
-    //    auto* new_next_block_descriptor = reinterpret_cast<size_t*>(reinterpret_cast<char*>(block_to_deallocate_address) + prev_block_size);
-    //    *new_next_block_descriptor = *previous_block_descriptor;
-    //}
+    auto block_to_deallocate_size = get_occupied_block_size(block_to_deallocate_address);
+    auto* const previous_block = get_occupied_block_previous_block_address(block_to_deallocate_address);
+    auto* const next_block = get_occupied_block_next_block_address(block_to_deallocate_address);
 
-    //else if (previous_block_free) {
-    //    //     
-    //    size_t prev_block_size = *(previous_block_descriptor - 1);
+    //       ,        
+    if (next_block != nullptr && !get_block_occupancy(next_block))
+    {
+        this->trace_with_guard("Merging next available block with target block...");
+        remove_available_block(next_block);
+        block_to_deallocate_size += get_available_block_size(next_block);
+        this->trace_with_guard("Merging completed");
+    }
 
-    //    //
-    //    *previous_block_descriptor = prev_block_size + block_size + sizeof(size_t);
+    if (previous_block != nullptr && !get_block_occupancy(previous_block))
+    {
+        this->trace_with_guard("Merging previous available block with target block...");
+        remove_available_block(previous_block);
+        block_to_deallocate_size += get_available_block_size(previous_block);
+        block_to_deallocate_address = previous_block;
+        this->trace_with_guard("Merging completed");
+    }
 
-    //    auto* new_next_block_descriptor = reinterpret_cast<size_t*>(reinterpret_cast<char*>(block_to_deallocate_address) + prev_block_size);
-    //    *new_next_block_descriptor = *previous_block_descriptor;
-    //}
-    //else if (next_block_free) {
-    //    //     
-    //    size_t next_block_size = *next_block_descriptor;
+    write_block_tags(block_to_deallocate_address, block_to_deallocate_size, false);
+    insert_available_block(block_to_deallocate_address);
 
-    //    *before_the_block_to_deallocate_size = block_size + next_block_size + sizeof(size_t);
-    //}
+    if (is_growable())
+    {
+        release_extra_segment_if_available(block_to_deallocate_address);
+    }
 
     this->debug_with_guard("After `deallocate` (addr == " + address_to_hex(block_to_deallocate_address) + "):");
     dump_trusted_memory_blocks_state();
@@ -402,9 +782,64 @@ void allocator_border_descriptors::deallocate(void* block_to_deallocate_address)
 
 void* allocator_border_descriptors::reallocate(void* block_to_reallocate_address, size_t new_block_size)
 {
+    auto const got_typename = get_typename();
+    this->trace_with_guard("Method `void *" + got_typename + "::reallocate(void *block_to_reallocate_address, size_t new_block_size)` execution started");
+
+    auto const available_block_service_block_size = get_available_block_service_block_size();
+    auto* const block_address = reinterpret_cast<size_t*>(block_to_reallocate_address) - 1;
+
+    auto required_block_size = (new_block_size + get_occupied_block_service_block_size() + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1);
+    if (required_block_size < available_block_service_block_size)
+    {
+        required_block_size = available_block_service_block_size;
+    }
+
+    auto* next_block = get_occupied_block_next_block_address(block_address);
+    if (next_block != nullptr && get_block_occupancy(next_block))
+    {
+        next_block = nullptr;
+    }
+
+    auto const in_place_block_size = get_occupied_block_size(block_address) + (next_block == nullptr
+        ? 0
+        : get_available_block_size(next_block));
+
+    //              
+    if (required_block_size <= in_place_block_size)
+    {
+        if (next_block != nullptr)
+        {
+            this->trace_with_guard("Merging next available block with target block...");
+            remove_available_block(next_block);
+            this->trace_with_guard("Merging completed");
+        }
+
+        if (in_place_block_size - required_block_size < available_block_service_block_size)
+        {
+            write_block_tags(block_address, in_place_block_size, true);
+        }
+        else
+        {
+            auto* const block_leftover = reinterpret_cast<unsigned char*>(block_address) + required_block_size;
+            write_block_tags(block_leftover, in_place_block_size - required_block_size, false);
+            insert_available_block(block_leftover);
+
+            write_block_tags(block_address, required_block_size, true);
+        }
+
+        this->trace_with_guard("Block reallocated in place at " + address_to_hex(block_to_reallocate_address))
+            ->trace_with_guard("Method `void *" + got_typename + "::reallocate(void *block_to_reallocate_address, size_t new_block_size)` execution finished");
+
+        this->debug_with_guard("After `reallocate` for " + std::to_string(new_block_size) + " bytes (addr == " + address_to_hex(block_address) + "):");
+        dump_trusted_memory_blocks_state();
+        return block_to_reallocate_address;
+    }
+
+    this->trace_with_guard("Method `void *" + got_typename + "::reallocate(void *block_to_reallocate_address, size_t new_block_size)` execution finished");
+
     auto* new_block = allocate(new_block_size);
     auto occupied_block_service_block_size = get_occupied_block_service_block_size();
-    auto data_to_move_size = std::min(get_occupied_block_size(reinterpret_cast<unsigned char const*>(new_block) - occupied_block_service_block_size), get_occupied_block_size(reinterpret_cast<unsigned char const*>(block_to_reallocate_address) - occupied_block_service_block_size)) - occupied_block_service_block_size;
+    auto data_to_move_size = std::min(get_occupied_block_size(reinterpret_cast<size_t const*>(new_block) - 1), get_occupied_block_size(reinterpret_cast<size_t const*>(block_to_reallocate_address) - 1)) - occupied_block_service_block_size;
     memcpy(new_block, block_to_reallocate_address, data_to_move_size);
     deallocate(block_to_reallocate_address);
     return new_block;
@@ -425,7 +860,32 @@ bool allocator_border_descriptors::reallocate(void** block_to_reallocate_address
 
 void allocator_border_descriptors::setup_allocation_mode(allocator_fit_allocation::allocation_mode mode)
 {
+    if (mode == allocator_fit_allocation::allocation_mode::segregated_fit)
+    {
+        this->error_with_guard("segregated fit allocation mode is not supported by " + get_typename());
+
+        throw operation_not_supported();
+    }
+
     *reinterpret_cast<allocator_fit_allocation::allocation_mode*>(reinterpret_cast<unsigned char*>(_trusted_memory) + sizeof(size_t) + sizeof(allocator*) + sizeof(logger*)) = mode;
+    *get_next_fit_rover_address_address() = nullptr;
+}
+
+void allocator_border_descriptors::setup_default_alignment(size_t alignment)
+{
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+    {
+        auto const error_message = "alignment should be a power of two";
+
+        this->error_with_guard(error_message);
+
+        throw std::invalid_argument(error_message);
+    }
+
+    //       sizeof(size_t)
+    *(reinterpret_cast<size_t*>(get_first_extra_segment_address_address() + 1) + 1) = alignment < sizeof(size_t)
+        ? sizeof(size_t)
+        : alignment;
 }
 
 logger* allocator_border_descriptors::get_logger() const noexcept
@@ -13,15 +13,22 @@ class allocator_border_descriptors final :
     protected typename_holder,
     protected allocator_holder
 {
+private:
+
+    //         (   sizeof(size_t)).
+    static constexpr size_t _block_occupied_flag = 1;
+
 private:     
     void* _trusted_memory;
 
 public:
+    // growable == true,         ( )  .
     explicit allocator_border_descriptors(
         size_t memory_size,
         allocator* outer_allocator = nullptr,
         logger* logger = nullptr,
-        allocator_fit_allocation::allocation_mode allocation_mode = allocator_fit_allocation::allocation_mode::first_fit);
+        allocator_fit_allocation::allocation_mode allocation_mode = allocator_fit_allocation::allocation_mode::first_fit,
+        bool growable = false);
 
     allocator_border_descriptors(
         allocator_border_descriptors const& other) = delete;
@@ -42,10 +49,10 @@ private:
     //     .
     [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override;
 
-    //       .
+    //        (,     ).
     [[nodiscard]] size_t get_available_block_service_block_size() const noexcept override;
 
-    //       .
+    //        (   ).
     [[nodiscard]] size_t get_occupied_block_service_block_size() const noexcept override;
 
     //       .
@@ -54,10 +61,58 @@ private:
     //     .
     [[nodiscard]] void* get_first_available_block_address() const noexcept override;
 
+    //   ( )  .
+    [[nodiscard]] unsigned char* get_first_block_address() const noexcept;
+
+    //        .
+    [[nodiscard]] void** get_first_extra_segment_address_address() const noexcept;
+
+    // true,       .
+    [[nodiscard]] bool is_growable() const noexcept;
+
+    // ,   allocate    (  sizeof(size_t)).
+    [[nodiscard]] size_t get_default_alignment() const noexcept;
+
+    //    next_fit:  ,     (nullptr -    ).
+    [[nodiscard]] void** get_next_fit_rover_address_address() const noexcept;
+
+    //     ,        alignment,
+    //    (  )      .
+    [[nodiscard]] size_t get_available_block_aligned_block_offset(
+        void const* block_address,
+        size_t alignment) const noexcept;
+
+    // ,    sizeof(size_t),          8 .
+    [[nodiscard]] static unsigned char* get_aligned_block_address(
+        void* address) noexcept;
+
+    //       segment_address.
+    [[nodiscard]] unsigned char* get_extra_segment_first_block_address(
+        void* segment_address) const noexcept;
+
+    //        (  ).
+    [[nodiscard]] size_t get_extra_segment_service_block_size() const noexcept;
+
+    //  ,    required_block_size,       .
+    void attach_extra_segment(
+        size_t required_block_size);
+
+    //    ,    available_block_address   .
+    void release_extra_segment_if_available(
+        void* available_block_address);
+
+    // true,     block_pointer .
+    [[nodiscard]] bool get_block_occupancy(
+        void const* block_pointer) const override;
+
     //      current_block_address.
     size_t get_available_block_size(
         void const* current_block_address) const override;
 
+    //      current_block_address    .
+    void* get_available_block_previous_available_block_address(
+        void const* current_block_address) const override;
+
     //      current_block_address.
     void* get_available_block_next_available_block_address(
         void const* current_block_address) const override;
@@ -66,6 +121,41 @@ private:
     size_t get_occupied_block_size(
         void const* current_block_address) const override;
 
+    //   ( )     current_block_address,   ,  nullptr.
+    void* get_available_block_previous_block_address(
+        void const* current_block_address) const override;
+
+    //   ( )     current_block_address,   ,  nullptr.
+    void* get_available_block_next_block_address(
+        void const* current_block_address) const override;
+
+    //   ( )     current_block_address,   ,  nullptr.
+    void* get_occupied_block_previous_block_address(
+        void const* current_block_address) const override;
+
+    //   ( )     current_block_address,   ,  nullptr.
+    void* get_occupied_block_next_block_address(
+        void const* current_block_address) const override;
+
+    //       block_size    occupied.
+    void write_block_tags(
+        void* block_address,
+        size_t block_size,
+        bool occupied) const noexcept;
+
+    //        .
+    void insert_available_block(
+        void* block_address);
+
+    //       .
+    void remove_available_block(
+        void* block_address);
+
+    //   replacement_block_address     block_address     .
+    void replace_available_block(
+        void* block_address,
+        void* replacement_block_address);
+
     //      allocator_border_descriptors (   ).
     void dump_trusted_memory_blocks_state() const override;
 
@@ -75,10 +165,17 @@ public:
     void* allocate(
         size_t requested_block_size) override;
 
-    //      block_to_deallocate_address.
+    using allocator::deallocate;
+
+    //      block_to_deallocate_address,      .
     void deallocate(
         void* block_to_deallocate_address) override;
 
+    //    requested_block_size,     alignment ( ).
+    [[nodiscard]] void* allocate_aligned(
+        size_t requested_block_size,
+        size_t alignment) override;
+
     //  ,     new_block_size.  ,     .
     [[nodiscard]] void* reallocate(
         void* block_to_reallocate_address,
@@ -95,6 +192,10 @@ public:
     void setup_allocation_mode(
         allocator_fit_allocation::allocation_mode mode) override;
 
+    //  ( ),   allocate   ; , 16  SSE-.
+    void setup_default_alignment(
+        size_t alignment);
+
 private:
 
     //    logger,    .
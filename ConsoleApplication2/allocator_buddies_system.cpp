@@ -0,0 +1,442 @@
+#include <algorithm>
+#include <cstdint>
+#include "allocator_buddies_system.h"
+
+allocator_buddies_system::allocator_buddies_system(
+    size_t memory_size,
+    allocator *outer_allocator,
+    logger *log,
+    allocator_fit_allocation::allocation_mode allocation_mode)
+{
+    auto got_typename = get_typename();
+
+    if (log != nullptr)
+    {
+        log->trace(got_typename + " allocator instance construction started")
+            ->debug("requested memory size: " + std::to_string(memory_size) + " bytes");
+    }
+
+    auto const minimal_trusted_memory_size = get_available_block_service_block_size();
+
+    // ,     size_t,   sizeof(size_t) * 8 - 1
+    if (memory_size < minimal_trusted_memory_size || memory_size > static_cast<size_t>(1) << (sizeof(size_t) * 8 - 1))
+    {
+        auto error_message = "trusted memory size should be GT " + std::to_string(minimal_trusted_memory_size) + " bytes and LE " + std::to_string(static_cast<size_t>(1) << (sizeof(size_t) * 8 - 1)) + " bytes";
+
+        if (log != nullptr)
+        {
+            log->error(error_message);
+        }
+
+        throw allocator::memory_exception(error_message);
+    }
+
+    auto const space_order = get_block_order(memory_size);
+    auto const space_size = static_cast<size_t>(1) << space_order;
+
+    if (space_size != memory_size && log != nullptr)
+    {
+        log->debug("memory size rounded up to " + std::to_string(space_size) + " bytes");
+    }
+
+    auto const allocator_service_block_size = get_allocator_service_block_size();
+
+    _trusted_memory = outer_allocator == nullptr
+        ? ::operator new(space_size + allocator_service_block_size)
+        : outer_allocator->allocate(space_size + allocator_service_block_size);
+
+    auto * const memory_size_space = reinterpret_cast<size_t *>(_trusted_memory);
+    *memory_size_space = space_size;
+
+    auto * const outer_allocator_pointer_space = reinterpret_cast<allocator **>(memory_size_space + 1);
+    *outer_allocator_pointer_space = outer_allocator;
+
+    auto * const logger_pointer_space = reinterpret_cast<logger **>(outer_allocator_pointer_space + 1);
+    *logger_pointer_space = log;
+
+    auto * const allocation_mode_space = reinterpret_cast<allocator_fit_allocation::allocation_mode *>(logger_pointer_space + 1);
+    *allocation_mode_space = allocation_mode;
+
+    auto * const available_blocks_lists_bitmap_space = reinterpret_cast<unsigned long long *>(allocation_mode_space + 1);
+    *available_blocks_lists_bitmap_space = 0;
+
+    auto * const available_blocks_lists_space = reinterpret_cast<void **>(available_blocks_lists_bitmap_space + 1);
+    std::fill(available_blocks_lists_space, available_blocks_lists_space + _available_blocks_lists_count, nullptr);
+
+    insert_available_block(get_first_block_address(), space_order);
+
+    this->trace_with_guard(got_typename + " allocator instance construction finished");
+}
+
+allocator_buddies_system::~allocator_buddies_system() noexcept
+{
+    auto got_typename = get_typename();
+    this->trace_with_guard(got_typename + " allocator instance destruction started");
+
+    auto const * const logger = get_logger();
+
+    deallocate_with_guard(_trusted_memory);
+
+    if (logger != nullptr)
+    {
+        logger->trace(got_typename + " allocator instance destruction finished");
+    }
+}
+
+size_t allocator_buddies_system::get_trusted_memory_size() const noexcept
+{
+    return *reinterpret_cast<size_t *>(_trusted_memory);
+}
+
+allocator_fit_allocation::allocation_mode allocator_buddies_system::get_allocation_mode() const noexcept
+{
+    return *reinterpret_cast<allocator_fit_allocation::allocation_mode *>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *));
+}
+
+size_t allocator_buddies_system::get_allocator_service_block_size() const noexcept
+{
+    auto const memory_size_size = sizeof(size_t);
+    auto const outer_allocator_pointer_size = sizeof(allocator *);
+    auto const logger_pointer_size = sizeof(logger *);
+    auto const allocation_mode_size = sizeof(allocator_fit_allocation::allocation_mode);
+    auto const available_blocks_lists_bitmap_size = sizeof(unsigned long long);
+    auto const available_blocks_lists_size = sizeof(void *) * _available_blocks_lists_count;
+    auto const first_block_alignment_size = alignof(size_t) - 1;
+
+    return memory_size_size + outer_allocator_pointer_size + logger_pointer_size + allocation_mode_size +
+        available_blocks_lists_bitmap_size + available_blocks_lists_size + first_block_alignment_size;
+}
+
+size_t allocator_buddies_system::get_available_block_service_block_size() const noexcept
+{
+    auto const current_block_size_and_occupancy = sizeof(size_t);
+    auto const previous_available_block_pointer_size = sizeof(void *);
+    auto const next_available_block_pointer_size = sizeof(void *);
+
+    return current_block_size_and_occupancy + previous_available_block_pointer_size + next_available_block_pointer_size;
+}
+
+size_t allocator_buddies_system::get_occupied_block_service_block_size() const noexcept
+{
+    auto const current_block_size_and_occupancy = sizeof(size_t);
+
+    return current_block_size_and_occupancy;
+}
+
+bool allocator_buddies_system::get_block_occupancy(
+    void const *block_pointer) const
+{
+    return (*reinterpret_cast<size_t const *>(block_pointer) & 1) != 0;
+}
+
+unsigned char *allocator_buddies_system::get_first_block_address() const noexcept
+{
+    //        ;  -    32 ,       8 
+    auto const first_block_address = reinterpret_cast<uintptr_t>(get_available_blocks_list_first_block_address_address(0) + _available_blocks_lists_count);
+
+    return reinterpret_cast<unsigned char *>((first_block_address + alignof(size_t) - 1) & ~(alignof(size_t) - 1));
+}
+
+unsigned long long *allocator_buddies_system::get_available_blocks_lists_bitmap_address() const noexcept
+{
+    return reinterpret_cast<unsigned long long *>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *) + sizeof(allocator_fit_allocation::allocation_mode));
+}
+
+void **allocator_buddies_system::get_available_blocks_list_first_block_address_address(
+    size_t order) const noexcept
+{
+    return reinterpret_cast<void **>(get_available_blocks_lists_bitmap_address() + 1) + order;
+}
+
+size_t allocator_buddies_system::get_available_block_size(
+    void const *current_block_address) const
+{
+    return *reinterpret_cast<size_t const *>(current_block_address) & ~static_cast<size_t>(1);
+}
+
+void *allocator_buddies_system::get_available_block_previous_available_block_address(
+    void const *current_block_address) const
+{
+    return *reinterpret_cast<void * const *>(reinterpret_cast<size_t const *>(current_block_address) + 1);
+}
+
+void *allocator_buddies_system::get_available_block_next_available_block_address(
+    void const *current_block_address) const
+{
+    return *(reinterpret_cast<void * const *>(reinterpret_cast<size_t const *>(current_block_address) + 1) + 1);
+}
+
+size_t allocator_buddies_system::get_occupied_block_size(
+    void const *current_block_address) const
+{
+    return *reinterpret_cast<size_t const *>(current_block_address) & ~static_cast<size_t>(1);
+}
+
+size_t allocator_buddies_system::get_block_order(
+    size_t block_size) noexcept
+{
+    size_t order = 0;
+
+    //  sizeof(size_t) * 8   ,     
+    while (order < sizeof(size_t) * 8 - 1 && (static_cast<size_t>(1) << order) < block_size)
+    {
+        ++order;
+    }
+
+    return order;
+}
+
+void *allocator_buddies_system::get_buddy_address(
+    void const *block_address,
+    size_t block_size) const noexcept
+{
+    auto * const first_block = get_first_block_address();
+    auto const block_offset = static_cast<size_t>(reinterpret_cast<unsigned char const *>(block_address) - first_block);
+
+    return first_block + (block_offset ^ block_size);
+}
+
+void allocator_buddies_system::insert_available_block(
+    void *block_address,
+    size_t order)
+{
+    auto ** const list_first_block_address_address = get_available_blocks_list_first_block_address_address(order);
+    auto * const next_block = *list_first_block_address_address;
+
+    auto * const block_size_space = reinterpret_cast<size_t *>(block_address);
+    *block_size_space = static_cast<size_t>(1) << order;
+
+    auto * const block_previous_block_address_space = reinterpret_cast<void **>(block_size_space + 1);
+    *block_previous_block_address_space = nullptr;
+    *(block_previous_block_address_space + 1) = next_block;
+
+    if (next_block != nullptr)
+    {
+        *reinterpret_cast<void **>(reinterpret_cast<size_t *>(next_block) + 1) = block_address;
+    }
+
+    *list_first_block_address_address = block_address;
+    *get_available_blocks_lists_bitmap_address() |= 1ULL << order;
+}
+
+void allocator_buddies_system::remove_available_block(
+    void *block_address)
+{
+    auto const order = get_block_order(get_available_block_size(block_address));
+    auto * const previous_block = get_available_block_previous_available_block_address(block_address);
+    auto * const next_block = get_available_block_next_available_block_address(block_address);
+
+    if (previous_block == nullptr)
+    {
+        *get_available_blocks_list_first_block_address_address(order) = next_block;
+
+        if (next_block == nullptr)
+        {
+            *get_available_blocks_lists_bitmap_address() &= ~(1ULL << order);
+        }
+    }
+    else
+    {
+        *(reinterpret_cast<void **>(reinterpret_cast<size_t *>(previous_block) + 1) + 1) = next_block;
+    }
+
+    if (next_block != nullptr)
+    {
+        *reinterpret_cast<void **>(reinterpret_cast<size_t *>(next_block) + 1) = previous_block;
+    }
+}
+
+void allocator_buddies_system::dump_trusted_memory_blocks_state() const
+{
+    if (get_logger() == nullptr)
+    {
+        return;
+    }
+
+    std::string to_dump("|");
+    auto const memory_size = get_trusted_memory_size();
+    unsigned char *first_block = get_first_block_address();
+    unsigned char *current_block = first_block;
+
+    while (static_cast<size_t>(current_block - first_block) < memory_size)
+    {
+        auto const current_block_size = get_occupied_block_size(current_block);
+
+        to_dump += get_block_occupancy(current_block)
+            ? "occ "
+            : "avl ";
+
+        to_dump += std::to_string(current_block_size) + "|";
+        current_block += current_block_size;
+    }
+
+    this->debug_with_guard("Memory state: " + to_dump);
+}
+
+void *allocator_buddies_system::allocate(
+    size_t requested_block_size)
+{
+    auto const got_typename = get_typename();
+    this->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution started")
+        ->debug_with_guard("Requested " + std::to_string(requested_block_size) + " bytes of memory");
+
+    auto const occupied_block_service_block_size = get_occupied_block_service_block_size();
+    auto const available_block_service_block_size = get_available_block_service_block_size();
+
+    //      ,             size_t
+    if (requested_block_size > get_trusted_memory_size() - occupied_block_service_block_size)
+    {
+        auto const warning_message = "no memory available to allocate";
+
+        this->warning_with_guard(warning_message)
+            ->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution finished");
+
+        throw memory_exception(warning_message);
+    }
+
+    auto required_block_size = requested_block_size + occupied_block_service_block_size;
+    if (required_block_size < available_block_service_block_size)
+    {
+        required_block_size = available_block_service_block_size;
+    }
+
+    auto const required_order = get_block_order(required_block_size);
+    auto const suitable_lists_bitmap = required_order >= _available_blocks_lists_count
+        ? 0ULL
+        : *get_available_blocks_lists_bitmap_address() & (~0ULL << required_order);
+
+    if (suitable_lists_bitmap == 0)
+    {
+        auto const warning_message = "no memory available to allocate";
+
+        this->warning_with_guard(warning_message)
+            ->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution finished");
+
+        throw memory_exception(warning_message);
+    }
+
+    //    ,        
+    auto target_order = get_lowest_set_bit_index(suitable_lists_bitmap);
+    if (get_allocation_mode() == allocator_fit_allocation::allocation_mode::the_worst_fit)
+    {
+        target_order = _available_blocks_lists_count - 1;
+        while ((suitable_lists_bitmap >> target_order & 1) == 0)
+        {
+            --target_order;
+        }
+    }
+
+    auto * const target_block = reinterpret_cast<unsigned char *>(*get_available_blocks_list_first_block_address_address(target_order));
+    remove_available_block(target_block);
+
+    while (target_order > required_order)
+    {
+        --target_order;
+        insert_available_block(target_block + (static_cast<size_t>(1) << target_order), target_order);
+    }
+
+    auto const target_block_size = static_cast<size_t>(1) << required_order;
+
+    if (target_block_size - occupied_block_service_block_size != requested_block_size)
+    {
+        this->trace_with_guard("Requested " + std::to_string(requested_block_size) + " bytes, but reserved " + std::to_string(target_block_size - occupied_block_service_block_size) + " bytes in according to correct work of allocator");
+    }
+
+    auto * const target_block_size_address = reinterpret_cast<size_t *>(target_block);
+    *target_block_size_address = target_block_size | 1;
+
+    auto * const allocated_block = reinterpret_cast<void *>(target_block_size_address + 1);
+
+    this->trace_with_guard("Allocated block placed at " + address_to_hex(allocated_block))
+        ->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution finished");
+
+    this->debug_with_guard("After `allocate` for " + std::to_string(requested_block_size) + " bytes (addr == " +
+                               address_to_hex(target_block_size_address) + "):");
+    dump_trusted_memory_blocks_state();
+    return allocated_block;
+}
+
+void allocator_buddies_system::deallocate(
+    void *block_to_deallocate_address)
+{
+    auto const got_typename = get_typename();
+    this->trace_with_guard(got_typename + "::deallocate(void *block_to_deallocate_address) execution started");
+
+    block_to_deallocate_address = reinterpret_cast<void *>(reinterpret_cast<size_t *>(block_to_deallocate_address) - 1);
+
+    dump_occupied_block_before_deallocate(block_to_deallocate_address, get_logger());
+
+    auto const memory_size = get_trusted_memory_size();
+    auto block_to_deallocate_size = get_occupied_block_size(block_to_deallocate_address);
+
+    while (block_to_deallocate_size < memory_size)
+    {
+        auto * const buddy_block = get_buddy_address(block_to_deallocate_address, block_to_deallocate_size);
+
+        //        ,           
+        if (*reinterpret_cast<size_t const *>(buddy_block) != block_to_deallocate_size)
+        {
+            break;
+        }
+
+        this->trace_with_guard("Merging buddy block with target block...");
+        remove_available_block(buddy_block);
+        block_to_deallocate_address = std::min(block_to_deallocate_address, buddy_block);
+        block_to_deallocate_size <<= 1;
+        this->trace_with_guard("Merging completed");
+    }
+
+    insert_available_block(block_to_deallocate_address, get_block_order(block_to_deallocate_size));
+
+    this->debug_with_guard("After `deallocate` (addr == " + address_to_hex(block_to_deallocate_address) + "):");
+    dump_trusted_memory_blocks_state();
+    this->trace_with_guard(got_typename + "::deallocate method execution finished");
+}
+
+void *allocator_buddies_system::reallocate(
+    void *block_to_reallocate_address,
+    size_t new_block_size)
+{
+    auto * new_block = allocate(new_block_size);
+    auto occupied_block_service_block_size = get_occupied_block_service_block_size();
+    auto data_to_move_size = std::min(get_occupied_block_size(reinterpret_cast<unsigned char const *>(new_block) - occupied_block_service_block_size), get_occupied_block_size(reinterpret_cast<unsigned char const *>(block_to_reallocate_address) - occupied_block_service_block_size)) - occupied_block_service_block_size;
+    memcpy(new_block, block_to_reallocate_address, data_to_move_size);
+    deallocate(block_to_reallocate_address);
+    return new_block;
+}
+
+bool allocator_buddies_system::reallocate(
+    void **block_to_reallocate_address_address,
+    size_t new_block_size)
+{
+    try {
+        *block_to_reallocate_address_address = reallocate(*block_to_reallocate_address_address, new_block_size);
+        return true;
+    }
+    catch (std::exception const &ex)
+    {
+        this->warning_with_guard(ex.what());
+        return false;
+    }
+}
+
+void allocator_buddies_system::setup_allocation_mode(
+    allocator_fit_allocation::allocation_mode mode)
+{
+    *reinterpret_cast<allocator_fit_allocation::allocation_mode *>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *)) = mode;
+}
+
+logger *allocator_buddies_system::get_logger() const noexcept
+{
+    return *reinterpret_cast<logger **>(reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1) + 1);
+}
+
+std::string allocator_buddies_system::get_typename() const noexcept
+{
+    return "allocator_buddies_system";
+}
+
+allocator *allocator_buddies_system::get_allocator() const noexcept
+{
+    return *reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1);
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_BUDDIES_SYSTEM_H
+#define DATA_STRUCTURES_CPP_MEMORY_WITH_BUDDIES_SYSTEM_H
+
+#include "typename_holder.h"
+#include "logger.h"
+#include "logger_holder.h"
+#include "allocator.h"
+#include "allocator_fit_allocation.h"
+#include "allocator_holder.h"
+
+class allocator_buddies_system final:
+    public allocator_fit_allocation,
+    protected logger_holder,
+    protected typename_holder,
+    protected allocator_holder
+{
+
+private:
+
+    //    (     2^k,        ).
+    static constexpr size_t _available_blocks_lists_count = 64;
+
+private:
+
+    void *_trusted_memory;
+
+public:
+    //  ,     ,    :
+    //    ( ),    .
+    explicit allocator_buddies_system(
+        size_t memory_size,
+        allocator *outer_allocator = nullptr,
+        logger *logger = nullptr,
+        allocator_fit_allocation::allocation_mode allocation_mode = allocator_fit_allocation::allocation_mode::first_fit);
+
+    allocator_buddies_system(
+        allocator_buddies_system const &other) = delete;
+
+    allocator_buddies_system &operator=(
+        allocator_buddies_system const &other) = delete;
+
+    // .        
+    ~allocator_buddies_system() noexcept;
+
+private:
+
+    //      ( ).
+    [[nodiscard]] size_t get_trusted_memory_size() const noexcept override;
+
+    //  ,   
+    [[nodiscard]] allocator_fit_allocation::allocation_mode get_allocation_mode() const noexcept override;
+
+    //     .
+    [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override;
+
+    //       .
+    [[nodiscard]] size_t get_available_block_service_block_size() const noexcept override;
+
+    //       .
+    [[nodiscard]] size_t get_occupied_block_service_block_size() const noexcept override;
+
+    // true,     block_pointer .
+    [[nodiscard]] bool get_block_occupancy(
+        void const *block_pointer) const override;
+
+    //    -.
+    [[nodiscard]] unsigned char *get_first_block_address() const noexcept;
+
+    //       .
+    [[nodiscard]] unsigned long long *get_available_blocks_lists_bitmap_address() const noexcept;
+
+    //        order.
+    [[nodiscard]] void **get_available_blocks_list_first_block_address_address(
+        size_t order) const noexcept;
+
+    //      current_block_address.
+    size_t get_available_block_size(
+        void const *current_block_address) const override;
+
+    //         current_block_address.
+    void *get_available_block_previous_available_block_address(
+        void const *current_block_address) const override;
+
+    //         current_block_address.
+    void *get_available_block_next_available_block_address(
+        void const *current_block_address) const override;
+
+    //      current_block_address.
+    size_t get_occupied_block_size(
+        void const *current_block_address) const override;
+
+    //  k   2^k.
+    [[nodiscard]] static size_t get_block_order(
+        size_t block_size) noexcept;
+
+    //  -    block_size   block_address.
+    [[nodiscard]] void *get_buddy_address(
+        void const *block_address,
+        size_t block_size) const noexcept;
+
+    //    2^order       .
+    void insert_available_block(
+        void *block_address,
+        size_t order);
+
+    //        .
+    void remove_available_block(
+        void *block_address);
+
+    //      allocator_buddies_system (   ).
+    void dump_trusted_memory_blocks_state() const override;
+
+public:
+
+    //     requested_block_size       .
+    void *allocate(
+        size_t requested_block_size) override;
+
+    using allocator::deallocate;
+
+    //      block_to_deallocate_address,     .
+    void deallocate(
+        void *block_to_deallocate_address) override;
+
+    //  ,     new_block_size.
+    [[nodiscard]] void *reallocate(
+        void *block_to_reallocate_address,
+        size_t new_block_size) override;
+
+    //      .    ,    .
+    bool reallocate(
+        void **block_to_reallocate_address_address,
+        size_t new_block_size) override;
+
+public:
+
+    //    
+    void setup_allocation_mode(
+        allocator_fit_allocation::allocation_mode mode) override;
+
+private:
+
+    //    logger,    .
+    [[nodiscard]] logger *get_logger() const noexcept override;
+
+private:
+
+    //     (allocator_buddies_system).
+    [[nodiscard]] std::string get_typename() const noexcept override;
+
+private:
+
+    //     (  ).
+    [[nodiscard]] allocator *get_allocator() const noexcept override;
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_WITH_BUDDIES_SYSTEM_H
\ No newline at end of file
@@ -0,0 +1,786 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "allocator_cpu_cache.h"
+
+#if defined(__linux__) && defined(__x86_64__) && defined(__GNUC__)
+#if __has_include(<sys/rseq.h>)
+#include <sys/rseq.h>
+#define ALLOCATOR_CPU_CACHE_RSEQ
+#endif
+#endif
+
+struct allocator_cpu_cache::cpu_cache
+{
+    //     ;          high_water_mark 
+    size_t available_blocks_counts[_size_classes_count];
+};
+
+struct allocator_cpu_cache::thread_cache
+{
+    //,   ;    
+    std::atomic<allocator_cpu_cache *> owner;
+
+    //      owner
+    thread_cache *next;
+
+    //       ,   ,   ,    
+    cpu_cache cache;
+};
+
+struct allocator_cpu_cache::thread_caches_holder
+{
+    std::vector<thread_cache *> caches;
+
+    ~thread_caches_holder() noexcept;
+};
+
+namespace
+{
+
+    //,         allocator_cpu_cache.
+    std::mutex &get_thread_caches_registry_mutex()
+    {
+        static std::mutex registry_mutex;
+        return registry_mutex;
+    }
+
+#ifdef ALLOCATOR_CPU_CACHE_RSEQ
+
+    // restartable sequence     .
+    enum class rseq_result
+    {
+        committed,
+        rejected,
+        aborted
+    };
+
+    //  rseq,  glibc   ,  nullptr,  glibc   .
+    struct rseq *get_current_thread_rseq_area() noexcept
+    {
+        if (__rseq_size == 0)
+        {
+            return nullptr;
+        }
+
+        return reinterpret_cast<struct rseq *>(reinterpret_cast<char *>(__builtin_thread_pointer()) + __rseq_offset);
+    }
+
+    //     available_blocks  *blocks_count   block,        cpu_index.
+    // ,  , -  *blocks_count; ,       .
+    rseq_result rseq_pop(
+        struct rseq *rseq_area,
+        uint32_t cpu_index,
+        size_t *blocks_count,
+        void **available_blocks,
+        void **block) noexcept
+    {
+        __asm__ __volatile__ goto (
+            ".pushsection __rseq_cs, \"aw\"\n\t"
+            ".balign 32\n\t"
+            "3:\n\t"
+            ".long 0x0, 0x0\n\t"
+            ".quad 1f, (2f - 1f), 4f\n\t"
+            ".popsection\n\t"
+            "leaq 3b(%%rip), %%rax\n\t"
+            "movq %%rax, %[rseq_cs]\n\t"
+            "1:\n\t"
+            "cmpl %[cpu_index], %[current_cpu_index]\n\t"
+            "jnz 4f\n\t"
+            "movq %[blocks_count], %%rax\n\t"
+            "testq %%rax, %%rax\n\t"
+            "jz %l[rejected]\n\t"
+            "movq -8(%[available_blocks], %%rax, 8), %%rcx\n\t"
+            "movq %%rcx, (%[block])\n\t"
+            "decq %%rax\n\t"
+            "movq %%rax, %[blocks_count]\n\t"
+            "2:\n\t"
+            ".pushsection __rseq_failure, \"ax\"\n\t"
+            ".byte 0x0f, 0xb9, 0x3d\n\t"
+            ".long 0x53053053\n\t"
+            "4:\n\t"
+            "jmp %l[aborted]\n\t"
+            ".popsection\n\t"
+            :
+            : [rseq_cs] "m" (rseq_area->rseq_cs),
+              [current_cpu_index] "m" (rseq_area->cpu_id),
+              [cpu_index] "r" (cpu_index),
+              [blocks_count] "m" (*blocks_count),
+              [available_blocks] "r" (available_blocks),
+              [block] "r" (block)
+            : "memory", "cc", "rax", "rcx"
+            : rejected, aborted);
+
+        return rseq_result::committed;
+
+    rejected:
+        return rseq_result::rejected;
+
+    aborted:
+        return rseq_result::aborted;
+    }
+
+    // block    available_blocks  *blocks_count   capacity,        cpu_index.
+    //      ,      .
+    rseq_result rseq_push(
+        struct rseq *rseq_area,
+        uint32_t cpu_index,
+        size_t *blocks_count,
+        void **available_blocks,
+        size_t capacity,
+        void *block) noexcept
+    {
+        __asm__ __volatile__ goto (
+            ".pushsection __rseq_cs, \"aw\"\n\t"
+            ".balign 32\n\t"
+            "3:\n\t"
+            ".long 0x0, 0x0\n\t"
+            ".quad 1f, (2f - 1f), 4f\n\t"
+            ".popsection\n\t"
+            "leaq 3b(%%rip), %%rax\n\t"
+            "movq %%rax, %[rseq_cs]\n\t"
+            "1:\n\t"
+            "cmpl %[cpu_index], %[current_cpu_index]\n\t"
+            "jnz 4f\n\t"
+            "movq %[blocks_count], %%rax\n\t"
+            "cmpq %[capacity], %%rax\n\t"
+            "jae %l[rejected]\n\t"
+            "movq %[block], (%[available_blocks], %%rax, 8)\n\t"
+            "incq %%rax\n\t"
+            "movq %%rax, %[blocks_count]\n\t"
+            "2:\n\t"
+            ".pushsection __rseq_failure, \"ax\"\n\t"
+            ".byte 0x0f, 0xb9, 0x3d\n\t"
+            ".long 0x53053053\n\t"
+            "4:\n\t"
+            "jmp %l[aborted]\n\t"
+            ".popsection\n\t"
+            :
+            : [rseq_cs] "m" (rseq_area->rseq_cs),
+              [current_cpu_index] "m" (rseq_area->cpu_id),
+              [cpu_index] "r" (cpu_index),
+              [blocks_count] "m" (*blocks_count),
+              [available_blocks] "r" (available_blocks),
+              [capacity] "r" (capacity),
+              [block] "r" (block)
+            : "memory", "cc", "rax"
+            : rejected, aborted);
+
+        return rseq_result::committed;
+
+    rejected:
+        return rseq_result::rejected;
+
+    aborted:
+        return rseq_result::aborted;
+    }
+
+#endif
+
+    // true,      restartable sequences;     .
+    bool is_rseq_available() noexcept
+    {
+#ifdef ALLOCATOR_CPU_CACHE_RSEQ
+        return get_current_thread_rseq_area() != nullptr;
+#else
+        return false;
+#endif
+    }
+
+}
+
+allocator_cpu_cache::thread_caches_holder::~thread_caches_holder() noexcept
+{
+    std::lock_guard<std::mutex> registry_lock(get_thread_caches_registry_mutex());
+
+    //       :    
+    for (auto *cache : caches)
+    {
+        auto *owner = cache->owner.load(std::memory_order_relaxed);
+
+        if (owner != nullptr)
+        {
+            owner->drain_cache(cache->cache);
+
+            auto **cache_address_address = owner->get_first_thread_cache_address_address();
+            while (*cache_address_address != cache)
+            {
+                cache_address_address = &(*cache_address_address)->next;
+            }
+
+            *cache_address_address = cache->next;
+        }
+
+        cache->~thread_cache();
+        ::operator delete(cache);
+    }
+}
+
+allocator_cpu_cache::allocator_cpu_cache(
+    allocator *backing_allocator,
+    logger *log,
+    size_t high_water_mark,
+    size_t batch_size,
+    size_t cpu_caches_count)
+{
+    auto got_typename = get_typename();
+
+    if (!is_rseq_available())
+    {
+        cpu_caches_count = 0;
+    }
+    else if (cpu_caches_count == 0)
+    {
+        cpu_caches_count = std::thread::hardware_concurrency();
+
+        if (cpu_caches_count == 0)
+        {
+            cpu_caches_count = 1;
+        }
+    }
+
+    if (log != nullptr)
+    {
+        log->trace(got_typename + " allocator instance construction started")
+            ->debug("high water mark: " + std::to_string(high_water_mark) + " blocks, batch size: " + std::to_string(batch_size) + " blocks, cpu caches: " + std::to_string(cpu_caches_count));
+    }
+
+    if (batch_size == 0 || batch_size > high_water_mark)
+    {
+        auto error_message = "batch size should be GT 0 and LE high water mark";
+
+        if (log != nullptr)
+        {
+            log->error(error_message);
+        }
+
+        throw std::invalid_argument(error_message);
+    }
+
+    //    ,         
+    auto const allocator_service_block_size = sizeof(allocator *) + sizeof(logger *) + 3 * sizeof(size_t) + sizeof(thread_cache *) + sizeof(std::mutex) + _cpu_cache_alignment - 1 + cpu_caches_count * get_cpu_cache_size(high_water_mark);
+
+    _trusted_memory = backing_allocator == nullptr
+        ? ::operator new(allocator_service_block_size)
+        : backing_allocator->allocate(allocator_service_block_size);
+
+    auto * const backing_allocator_pointer_space = reinterpret_cast<allocator **>(_trusted_memory);
+    *backing_allocator_pointer_space = backing_allocator;
+
+    auto * const logger_pointer_space = reinterpret_cast<logger **>(backing_allocator_pointer_space + 1);
+    *logger_pointer_space = log;
+
+    auto * const high_water_mark_space = reinterpret_cast<size_t *>(logger_pointer_space + 1);
+    *high_water_mark_space = high_water_mark;
+
+    auto * const batch_size_space = high_water_mark_space + 1;
+    *batch_size_space = batch_size;
+
+    auto * const cpu_caches_count_space = batch_size_space + 1;
+    *cpu_caches_count_space = cpu_caches_count;
+
+    auto * const first_thread_cache_pointer_space = reinterpret_cast<thread_cache **>(cpu_caches_count_space + 1);
+    *first_thread_cache_pointer_space = nullptr;
+
+    new (first_thread_cache_pointer_space + 1) std::mutex();
+
+    for (size_t cpu_cache_index = 0; cpu_cache_index < cpu_caches_count; cpu_cache_index++)
+    {
+        auto *cache = new (&get_cpu_cache(cpu_cache_index)) cpu_cache;
+        std::fill(cache->available_blocks_counts, cache->available_blocks_counts + _size_classes_count, 0);
+    }
+
+    this->trace_with_guard(got_typename + " allocator instance construction finished");
+}
+
+allocator_cpu_cache::~allocator_cpu_cache() noexcept
+{
+    auto got_typename = get_typename();
+    this->trace_with_guard(got_typename + " allocator instance destruction started");
+
+    auto const * const logger = get_logger();
+
+    {
+        std::lock_guard<std::mutex> registry_lock(get_thread_caches_registry_mutex());
+
+        //          
+        for (auto *cache = *get_first_thread_cache_address_address(); cache != nullptr; cache = cache->next)
+        {
+            drain_cache(cache->cache);
+            cache->owner.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    for (size_t cpu_cache_index = 0; cpu_cache_index < get_cpu_caches_count(); cpu_cache_index++)
+    {
+        auto &cache = get_cpu_cache(cpu_cache_index);
+
+        drain_cache(cache);
+        cache.~cpu_cache();
+    }
+
+    get_backing_allocator_mutex().~mutex();
+
+    deallocate_with_guard(_trusted_memory);
+
+    if (logger != nullptr)
+    {
+        logger->trace(got_typename + " allocator instance destruction finished");
+    }
+}
+
+size_t allocator_cpu_cache::get_allocator_service_block_size() const noexcept
+{
+    auto const backing_allocator_pointer_size = sizeof(allocator *);
+    auto const logger_pointer_size = sizeof(logger *);
+    auto const high_water_mark_size = sizeof(size_t);
+    auto const batch_size_size = sizeof(size_t);
+    auto const cpu_caches_count_size = sizeof(size_t);
+    auto const first_thread_cache_pointer_size = sizeof(thread_cache *);
+    auto const backing_allocator_mutex_size = sizeof(std::mutex);
+    auto const cpu_caches_alignment_size = _cpu_cache_alignment - 1;
+    auto const cpu_caches_size = get_cpu_caches_count() * get_cpu_cache_size(get_high_water_mark());
+
+    return backing_allocator_pointer_size + logger_pointer_size + high_water_mark_size + batch_size_size + cpu_caches_count_size + first_thread_cache_pointer_size +
+        backing_allocator_mutex_size + cpu_caches_alignment_size + cpu_caches_size;
+}
+
+size_t allocator_cpu_cache::get_occupied_block_service_block_size() const noexcept
+{
+    auto const block_capacity_size = sizeof(size_t);
+
+    return block_capacity_size;
+}
+
+size_t allocator_cpu_cache::get_occupied_block_size(
+    void const *current_block_address) const
+{
+    return *reinterpret_cast<size_t const *>(current_block_address);
+}
+
+size_t allocator_cpu_cache::get_high_water_mark() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1) + 1);
+}
+
+size_t allocator_cpu_cache::get_batch_size() const noexcept
+{
+    return *(reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1) + 1) + 1);
+}
+
+size_t allocator_cpu_cache::get_cpu_caches_count() const noexcept
+{
+    return *(reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1) + 1) + 2);
+}
+
+allocator_cpu_cache::thread_cache **allocator_cpu_cache::get_first_thread_cache_address_address() const noexcept
+{
+    return reinterpret_cast<thread_cache **>(reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1) + 1) + 3);
+}
+
+std::mutex &allocator_cpu_cache::get_backing_allocator_mutex() const noexcept
+{
+    return *reinterpret_cast<std::mutex *>(get_first_thread_cache_address_address() + 1);
+}
+
+size_t allocator_cpu_cache::get_cpu_cache_size(
+    size_t high_water_mark) noexcept
+{
+    auto const available_blocks_size = _size_classes_count * high_water_mark * sizeof(void *);
+
+    return (sizeof(cpu_cache) + available_blocks_size + _cpu_cache_alignment - 1) & ~(_cpu_cache_alignment - 1);
+}
+
+allocator_cpu_cache::cpu_cache &allocator_cpu_cache::get_cpu_cache(
+    size_t cpu_cache_index) const noexcept
+{
+    auto const cpu_caches_address = reinterpret_cast<uintptr_t>(&get_backing_allocator_mutex() + 1);
+    auto * const first_cpu_cache = reinterpret_cast<unsigned char *>((cpu_caches_address + _cpu_cache_alignment - 1) & ~(_cpu_cache_alignment - 1));
+
+    return *reinterpret_cast<cpu_cache *>(first_cpu_cache + cpu_cache_index * get_cpu_cache_size(get_high_water_mark()));
+}
+
+void **allocator_cpu_cache::get_available_blocks(
+    cpu_cache &cache,
+    size_t size_class_index) const noexcept
+{
+    return reinterpret_cast<void **>(&cache + 1) + size_class_index * get_high_water_mark();
+}
+
+allocator_cpu_cache::cpu_cache &allocator_cpu_cache::get_current_thread_cache()
+{
+    static thread_local thread_caches_holder holder;
+
+    for (auto *cache : holder.caches)
+    {
+        if (cache->owner.load(std::memory_order_relaxed) == this)
+        {
+            return cache->cache;
+        }
+    }
+
+    this->trace_with_guard("Creating thread cache for " + get_typename() + " at " + address_to_hex(this));
+
+    std::lock_guard<std::mutex> registry_lock(get_thread_caches_registry_mutex());
+
+    //       ,  
+    holder.caches.erase(std::remove_if(holder.caches.begin(), holder.caches.end(), [](thread_cache *cache)
+    {
+        if (cache->owner.load(std::memory_order_relaxed) != nullptr)
+        {
+            return false;
+        }
+
+        cache->~thread_cache();
+        ::operator delete(cache);
+        return true;
+    }), holder.caches.end());
+
+    //      ,     
+    auto *cache = new (::operator new(sizeof(thread_cache) + _size_classes_count * get_high_water_mark() * sizeof(void *))) thread_cache;
+    cache->owner.store(this, std::memory_order_relaxed);
+    std::fill(cache->cache.available_blocks_counts, cache->cache.available_blocks_counts + _size_classes_count, 0);
+
+    auto **first_thread_cache_address_address = get_first_thread_cache_address_address();
+    cache->next = *first_thread_cache_address_address;
+    *first_thread_cache_address_address = cache;
+
+    holder.caches.push_back(cache);
+
+    return cache->cache;
+}
+
+void allocator_cpu_cache::drain_cache(
+    cpu_cache &cache)
+{
+    std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+
+    for (size_t size_class_index = 0; size_class_index < _size_classes_count; size_class_index++)
+    {
+        auto * const available_blocks = get_available_blocks(cache, size_class_index);
+
+        for (size_t i = 0; i < cache.available_blocks_counts[size_class_index]; i++)
+        {
+            deallocate_with_guard(reinterpret_cast<size_t *>(available_blocks[i]) - 1);
+        }
+
+        cache.available_blocks_counts[size_class_index] = 0;
+    }
+}
+
+void *allocator_cpu_cache::try_pop_from_current_cpu_cache(
+    size_t size_class_index)
+{
+#ifdef ALLOCATOR_CPU_CACHE_RSEQ
+    if (auto * const rseq_area = get_current_thread_rseq_area(); rseq_area != nullptr)
+    {
+        //     :   rseq        
+        for (;;)
+        {
+            auto const cpu_index = *reinterpret_cast<uint32_t volatile *>(&rseq_area->cpu_id);
+
+            if (static_cast<int32_t>(cpu_index) < 0 || cpu_index >= get_cpu_caches_count())
+            {
+                return nullptr;
+            }
+
+            auto &cache = get_cpu_cache(cpu_index);
+            void *block;
+
+            switch (rseq_pop(rseq_area, cpu_index, &cache.available_blocks_counts[size_class_index], get_available_blocks(cache, size_class_index), &block))
+            {
+                case rseq_result::committed:
+                    return block;
+                case rseq_result::rejected:
+                    return nullptr;
+                case rseq_result::aborted:
+                    break;
+            }
+        }
+    }
+#endif
+
+    //    ,     
+    auto &cache = get_current_thread_cache();
+
+    if (cache.available_blocks_counts[size_class_index] == 0)
+    {
+        return nullptr;
+    }
+
+    return get_available_blocks(cache, size_class_index)[--cache.available_blocks_counts[size_class_index]];
+}
+
+bool allocator_cpu_cache::try_push_into_current_cpu_cache(
+    void *block_address,
+    size_t size_class_index)
+{
+#ifdef ALLOCATOR_CPU_CACHE_RSEQ
+    if (auto * const rseq_area = get_current_thread_rseq_area(); rseq_area != nullptr)
+    {
+        for (;;)
+        {
+            auto const cpu_index = *reinterpret_cast<uint32_t volatile *>(&rseq_area->cpu_id);
+
+            if (static_cast<int32_t>(cpu_index) < 0 || cpu_index >= get_cpu_caches_count())
+            {
+                return false;
+            }
+
+            auto &cache = get_cpu_cache(cpu_index);
+
+            switch (rseq_push(rseq_area, cpu_index, &cache.available_blocks_counts[size_class_index], get_available_blocks(cache, size_class_index), get_high_water_mark(), block_address))
+            {
+                case rseq_result::committed:
+                    return true;
+                case rseq_result::rejected:
+                    return false;
+                case rseq_result::aborted:
+                    break;
+            }
+        }
+    }
+#endif
+
+    auto &cache = get_current_thread_cache();
+
+    if (cache.available_blocks_counts[size_class_index] >= get_high_water_mark())
+    {
+        return false;
+    }
+
+    get_available_blocks(cache, size_class_index)[cache.available_blocks_counts[size_class_index]++] = block_address;
+
+    return true;
+}
+
+void *allocator_cpu_cache::refill_current_cpu_cache(
+    size_t size_class_index)
+{
+    auto const block_capacity = (size_class_index + 1) * _size_class_granularity;
+    auto const batch_size = get_batch_size();
+    size_t *allocated_block;
+
+    std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+
+    try
+    {
+        allocated_block = reinterpret_cast<size_t *>(allocate_with_guard(get_occupied_block_service_block_size() + block_capacity));
+    }
+    catch (std::exception const &)
+    {
+        auto const warning_message = "no memory available to allocate";
+
+        this->warning_with_guard(warning_message);
+
+        throw memory_exception(warning_message);
+    }
+
+    *allocated_block = block_capacity;
+
+    try
+    {
+        for (size_t refilled_blocks_count = 1; refilled_blocks_count < batch_size; refilled_blocks_count++)
+        {
+            auto *block = reinterpret_cast<size_t *>(allocate_with_guard(get_occupied_block_service_block_size() + block_capacity));
+            *block = block_capacity;
+
+            // ,        
+            if (!try_push_into_current_cpu_cache(block + 1, size_class_index))
+            {
+                deallocate_with_guard(block);
+                break;
+            }
+        }
+    }
+    catch (std::exception const &)
+    {
+        //  :    
+    }
+
+    return allocated_block + 1;
+}
+
+void allocator_cpu_cache::drain_current_cpu_cache(
+    void *block_to_deallocate_address,
+    size_t size_class_index)
+{
+    auto const batch_size = get_batch_size();
+
+    std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+
+    deallocate_with_guard(reinterpret_cast<size_t *>(block_to_deallocate_address) - 1);
+
+    for (size_t drained_blocks_count = 1; drained_blocks_count < batch_size; drained_blocks_count++)
+    {
+        auto *block = try_pop_from_current_cpu_cache(size_class_index);
+
+        if (block == nullptr)
+        {
+            break;
+        }
+
+        deallocate_with_guard(reinterpret_cast<size_t *>(block) - 1);
+    }
+}
+
+void *allocator_cpu_cache::allocate_from_backing_allocator(
+    size_t block_capacity)
+{
+    if (block_capacity > std::numeric_limits<size_t>::max() - get_occupied_block_service_block_size())
+    {
+        auto const warning_message = "no memory available to allocate";
+
+        this->warning_with_guard(warning_message);
+
+        throw memory_exception(warning_message);
+    }
+
+    size_t *block;
+
+    {
+        std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+        block = reinterpret_cast<size_t *>(allocate_with_guard(get_occupied_block_service_block_size() + block_capacity));
+    }
+
+    *block = block_capacity;
+    return block + 1;
+}
+
+void allocator_cpu_cache::deallocate_into_backing_allocator(
+    void *block_to_deallocate_address)
+{
+    std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+    deallocate_with_guard(reinterpret_cast<size_t *>(block_to_deallocate_address) - 1);
+}
+
+size_t allocator_cpu_cache::get_natural_alignment() const noexcept
+{
+    return std::min(get_natural_alignment_with_guard(), alignof(size_t));
+}
+
+void *allocator_cpu_cache::allocate(
+    size_t requested_block_size)
+{
+    auto const size_class_index = requested_block_size == 0
+        ? 0
+        : (requested_block_size - 1) / _size_class_granularity;
+
+    if (size_class_index >= _size_classes_count)
+    {
+        return allocate_from_backing_allocator(requested_block_size);
+    }
+
+    if (auto *allocated_block = try_pop_from_current_cpu_cache(size_class_index); allocated_block != nullptr)
+    {
+        return allocated_block;
+    }
+
+    return refill_current_cpu_cache(size_class_index);
+}
+
+void allocator_cpu_cache::deallocate(
+    void *block_to_deallocate_address)
+{
+    auto const block_capacity = get_occupied_block_size(reinterpret_cast<size_t *>(block_to_deallocate_address) - 1);
+
+    if (block_capacity > _size_classes_count * _size_class_granularity)
+    {
+        deallocate_into_backing_allocator(block_to_deallocate_address);
+        return;
+    }
+
+    deallocate_into_cpu_cache(block_to_deallocate_address, block_capacity / _size_class_granularity - 1);
+}
+
+void allocator_cpu_cache::deallocate(
+    void *block_to_deallocate_address,
+    size_t block_size)
+{
+    auto const size_class_index = block_size == 0
+        ? 0
+        : (block_size - 1) / _size_class_granularity;
+
+#ifdef _DEBUG
+    //      :     ,    
+    auto const block_capacity = get_occupied_block_size(reinterpret_cast<size_t *>(block_to_deallocate_address) - 1);
+    if (size_class_index >= _size_classes_count
+        ? block_capacity != block_size
+        : block_capacity != (size_class_index + 1) * _size_class_granularity)
+    {
+        auto const error_message = "deallocated block size " + std::to_string(block_size) + " bytes does not match allocated block capacity " + std::to_string(block_capacity) + " bytes";
+
+        this->error_with_guard(error_message);
+
+        throw std::invalid_argument(error_message);
+    }
+#endif
+
+    if (size_class_index >= _size_classes_count)
+    {
+        deallocate_into_backing_allocator(block_to_deallocate_address);
+        return;
+    }
+
+    deallocate_into_cpu_cache(block_to_deallocate_address, size_class_index);
+}
+
+void allocator_cpu_cache::deallocate_into_cpu_cache(
+    void *block_to_deallocate_address,
+    size_t size_class_index)
+{
+    if (!try_push_into_current_cpu_cache(block_to_deallocate_address, size_class_index))
+    {
+        drain_current_cpu_cache(block_to_deallocate_address, size_class_index);
+    }
+}
+
+void *allocator_cpu_cache::reallocate(
+    void *block_to_reallocate_address,
+    size_t new_block_size)
+{
+    auto * new_block = allocate(new_block_size);
+    auto const new_block_capacity = get_occupied_block_size(reinterpret_cast<size_t const *>(new_block) - 1);
+    auto const block_capacity = get_occupied_block_size(reinterpret_cast<size_t const *>(block_to_reallocate_address) - 1);
+    memcpy(new_block, block_to_reallocate_address, new_block_capacity < block_capacity
+        ? new_block_capacity
+        : block_capacity);
+    deallocate(block_to_reallocate_address);
+    return new_block;
+}
+
+bool allocator_cpu_cache::reallocate(
+    void **block_to_reallocate_address_address,
+    size_t new_block_size)
+{
+    try {
+        *block_to_reallocate_address_address = reallocate(*block_to_reallocate_address_address, new_block_size);
+        return true;
+    }
+    catch (std::exception const &ex)
+    {
+        this->warning_with_guard(ex.what());
+        return false;
+    }
+}
+
+logger *allocator_cpu_cache::get_logger() const noexcept
+{
+    return *reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1);
+}
+
+std::string allocator_cpu_cache::get_typename() const noexcept
+{
+    return "allocator_cpu_cache";
+}
+
+allocator *allocator_cpu_cache::get_allocator() const noexcept
+{
+    return *reinterpret_cast<allocator **>(_trusted_memory);
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_CPU_CACHE_H
+#define DATA_STRUCTURES_CPP_MEMORY_WITH_CPU_CACHE_H
+
+#include <mutex>
+#include "typename_holder.h"
+#include "logger.h"
+#include "logger_holder.h"
+#include "allocator.h"
+#include "allocator_holder.h"
+
+class allocator_cpu_cache final:
+    public allocator,
+    protected logger_holder,
+    protected typename_holder,
+    protected allocator_holder
+{
+
+private:
+
+    //     ( ).
+    static constexpr size_t _size_class_granularity = 16;
+
+    //  ;        .
+    static constexpr size_t _size_classes_count = 32;
+
+    //,        ,        .
+    static constexpr size_t _cpu_cache_alignment = 64;
+
+    //   (  allocator_cpu_cache.cpp).
+    struct cpu_cache;
+
+    //      allocator_cpu_cache ,   rseq (  allocator_cpu_cache.cpp).
+    struct thread_cache;
+
+    //   ,       .
+    struct thread_caches_holder;
+
+private:
+
+    void *_trusted_memory;
+
+public:
+
+    //    backing_allocator  cpu_caches_count  (0 -   ).
+    //      high_water_mark     ,
+    //     batch_size .     rseq ,  glibc  ;
+    //       cpu_caches_count     .
+    // rseq    :        ,    .
+    explicit allocator_cpu_cache(
+        allocator *backing_allocator,
+        logger *logger = nullptr,
+        size_t high_water_mark = 64,
+        size_t batch_size = 32,
+        size_t cpu_caches_count = 0);
+
+    allocator_cpu_cache(
+        allocator_cpu_cache const &other) = delete;
+
+    allocator_cpu_cache &operator=(
+        allocator_cpu_cache const &other) = delete;
+
+    // .            .
+    ~allocator_cpu_cache() noexcept;
+
+private:
+
+    //         .
+    [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override;
+
+    //        ( ).
+    [[nodiscard]] size_t get_occupied_block_service_block_size() const noexcept override;
+
+    //      current_block_address (   ).
+    size_t get_occupied_block_size(
+        void const *current_block_address) const override;
+
+    //         .
+    [[nodiscard]] size_t get_high_water_mark() const noexcept;
+
+    //  ,         .
+    [[nodiscard]] size_t get_batch_size() const noexcept;
+
+    //   .
+    [[nodiscard]] size_t get_cpu_caches_count() const noexcept;
+
+    //           .
+    [[nodiscard]] thread_cache **get_first_thread_cache_address_address() const noexcept;
+
+    // ,       .
+    [[nodiscard]] std::mutex &get_backing_allocator_mutex() const noexcept;
+
+    // ,        high_water_mark     .
+    [[nodiscard]] static size_t get_cpu_cache_size(
+        size_t high_water_mark) noexcept;
+
+    //     cpu_cache_index.
+    [[nodiscard]] cpu_cache &get_cpu_cache(
+        size_t cpu_cache_index) const noexcept;
+
+    //      size_class_index   cache.
+    [[nodiscard]] void **get_available_blocks(
+        cpu_cache &cache,
+        size_t size_class_index) const noexcept;
+
+    //      ,     .
+    [[nodiscard]] cpu_cache &get_current_thread_cache();
+
+    //      cache.
+    void drain_cache(
+        cpu_cache &cache);
+
+    //    size_class_index     ( rseq - );   ,  nullptr.
+    [[nodiscard]] void *try_pop_from_current_cpu_cache(
+        size_t size_class_index);
+
+    //    size_class_index     ( rseq - );   ,  false.
+    bool try_push_into_current_cpu_cache(
+        void *block_address,
+        size_t size_class_index);
+
+    //        size_class_index:  ,      .
+    [[nodiscard]] void *refill_current_cpu_cache(
+        size_t size_class_index);
+
+    //      size_class_index        .
+    void drain_current_cpu_cache(
+        void *block_to_deallocate_address,
+        size_t size_class_index);
+
+    //   block_capacity      .
+    [[nodiscard]] void *allocate_from_backing_allocator(
+        size_t block_capacity);
+
+    //      .
+    void deallocate_into_backing_allocator(
+        void *block_to_deallocate_address);
+
+    //    size_class_index    ;    .
+    void deallocate_into_cpu_cache(
+        void *block_to_deallocate_address,
+        size_t size_class_index);
+
+public:
+
+    //  :          ( ).
+    [[nodiscard]] size_t get_natural_alignment() const noexcept override;
+
+    //     requested_block_size,      .
+    void *allocate(
+        size_t requested_block_size) override;
+
+    //     block_to_deallocate_address    .
+    void deallocate(
+        void *block_to_deallocate_address) override;
+
+    //   block_size   ;     block_size    .
+    void deallocate(
+        void *block_to_deallocate_address,
+        size_t block_size) override;
+
+    //  ,     new_block_size.
+    [[nodiscard]] void *reallocate(
+        void *block_to_reallocate_address,
+        size_t new_block_size) override;
+
+    //      .    ,    .
+    bool reallocate(
+        void **block_to_reallocate_address_address,
+        size_t new_block_size) override;
+
+private:
+
+    //    logger,    .
+    [[nodiscard]] logger *get_logger() const noexcept override;
+
+private:
+
+    //     (allocator_cpu_cache).
+    [[nodiscard]] std::string get_typename() const noexcept override;
+
+private:
+
+    //    .
+    [[nodiscard]] allocator *get_allocator() const noexcept override;
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_WITH_CPU_CACHE_H
\ No newline at end of file
@@ -0,0 +1,453 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "allocator_deferred_deallocation.h"
+
+struct allocator_deferred_deallocation::reclaimer_state
+{
+    //,       
+    std::mutex backing_allocator_mutex;
+
+    //,      
+    std::mutex reclaimer_mutex;
+
+    std::condition_variable reclaimer_wakeup;
+
+    std::condition_variable blocks_reclaimed;
+
+    bool stop_requested;
+
+    bool flush_requested;
+
+    size_t buffer_capacity;
+
+    size_t batch_size;
+
+    std::chrono::milliseconds reclaim_interval;
+
+    //  ,     
+    std::atomic<size_t> enqueue_position;
+
+    // ,   ,    
+    unsigned char enqueue_position_padding[64];
+
+    //  ,        (   )
+    size_t dequeue_position;
+
+    std::atomic<size_t> reclaimed_blocks_count;
+
+    std::atomic<size_t> synchronous_deallocations_count;
+
+    std::atomic<size_t> last_batch_reclaim_lag_nanoseconds;
+
+    std::atomic<size_t> max_reclaim_lag_nanoseconds;
+
+    std::thread reclaimer_thread;
+};
+
+struct allocator_deferred_deallocation::buffer_slot
+{
+    // ,    : position -  , position + 1 -  
+    std::atomic<size_t> sequence;
+
+    void *block;
+
+    //   (   )
+    size_t enqueued_at_nanoseconds;
+};
+
+namespace
+{
+
+    //     .
+    size_t get_steady_clock_nanoseconds() noexcept
+    {
+        return static_cast<size_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+}
+
+allocator_deferred_deallocation::allocator_deferred_deallocation(
+    allocator *backing_allocator,
+    logger *log,
+    size_t buffer_capacity,
+    size_t batch_size,
+    size_t reclaim_interval_milliseconds)
+{
+    auto got_typename = get_typename();
+
+    if (log != nullptr)
+    {
+        log->trace(got_typename + " allocator instance construction started")
+            ->debug("buffer capacity: " + std::to_string(buffer_capacity) + " blocks, batch size: " + std::to_string(batch_size) + " blocks, reclaim interval: " + std::to_string(reclaim_interval_milliseconds) + " ms");
+    }
+
+    if (backing_allocator == nullptr || buffer_capacity == 0 || (buffer_capacity & (buffer_capacity - 1)) != 0 || batch_size == 0 || batch_size > buffer_capacity || reclaim_interval_milliseconds == 0)
+    {
+        auto error_message = "backing allocator should be set, buffer capacity should be a power of 2 and batch size should be GT 0 and LE buffer capacity, reclaim interval should be GT 0";
+
+        if (log != nullptr)
+        {
+            log->error(error_message);
+        }
+
+        throw std::invalid_argument(error_message);
+    }
+
+    auto const allocator_service_block_size = sizeof(allocator *) + sizeof(logger *) + alignof(reclaimer_state) - 1 + sizeof(reclaimer_state) + buffer_capacity * sizeof(buffer_slot);
+
+    _trusted_memory = backing_allocator->allocate(allocator_service_block_size);
+
+    auto * const backing_allocator_pointer_space = reinterpret_cast<allocator **>(_trusted_memory);
+    *backing_allocator_pointer_space = backing_allocator;
+
+    auto * const logger_pointer_space = reinterpret_cast<logger **>(backing_allocator_pointer_space + 1);
+    *logger_pointer_space = log;
+
+    auto &state = *new (&get_reclaimer_state()) reclaimer_state;
+    state.stop_requested = false;
+    state.flush_requested = false;
+    state.buffer_capacity = buffer_capacity;
+    state.batch_size = batch_size;
+    state.reclaim_interval = std::chrono::milliseconds(reclaim_interval_milliseconds);
+    state.enqueue_position.store(0, std::memory_order_relaxed);
+    state.dequeue_position = 0;
+    state.reclaimed_blocks_count.store(0, std::memory_order_relaxed);
+    state.synchronous_deallocations_count.store(0, std::memory_order_relaxed);
+    state.last_batch_reclaim_lag_nanoseconds.store(0, std::memory_order_relaxed);
+    state.max_reclaim_lag_nanoseconds.store(0, std::memory_order_relaxed);
+
+    for (size_t position = 0; position < buffer_capacity; position++)
+    {
+        new (&get_buffer_slot(position)) buffer_slot;
+        get_buffer_slot(position).sequence.store(position, std::memory_order_relaxed);
+    }
+
+    try
+    {
+        state.reclaimer_thread = std::thread(&allocator_deferred_deallocation::run_reclaimer, this);
+    }
+    catch (...)
+    {
+        state.~reclaimer_state();
+        deallocate_with_guard(_trusted_memory);
+        throw;
+    }
+
+    this->trace_with_guard(got_typename + " allocator instance construction finished");
+}
+
+allocator_deferred_deallocation::~allocator_deferred_deallocation() noexcept
+{
+    auto got_typename = get_typename();
+    this->trace_with_guard(got_typename + " allocator instance destruction started");
+
+    auto const * const logger = get_logger();
+    auto &state = get_reclaimer_state();
+
+    //       
+    {
+        std::lock_guard<std::mutex> reclaimer_lock(state.reclaimer_mutex);
+        state.stop_requested = true;
+    }
+
+    state.reclaimer_wakeup.notify_one();
+    state.reclaimer_thread.join();
+
+    state.~reclaimer_state();
+
+    deallocate_with_guard(_trusted_memory);
+
+    if (logger != nullptr)
+    {
+        logger->trace(got_typename + " allocator instance destruction finished");
+    }
+}
+
+size_t allocator_deferred_deallocation::get_allocator_service_block_size() const noexcept
+{
+    auto const backing_allocator_pointer_size = sizeof(allocator *);
+    auto const logger_pointer_size = sizeof(logger *);
+    auto const reclaimer_state_alignment_size = alignof(reclaimer_state) - 1;
+    auto const reclaimer_state_size = sizeof(reclaimer_state);
+    auto const buffer_size = get_reclaimer_state().buffer_capacity * sizeof(buffer_slot);
+
+    return backing_allocator_pointer_size + logger_pointer_size + reclaimer_state_alignment_size + reclaimer_state_size + buffer_size;
+}
+
+size_t allocator_deferred_deallocation::get_occupied_block_service_block_size() const noexcept
+{
+    return 0;
+}
+
+allocator_deferred_deallocation::reclaimer_state &allocator_deferred_deallocation::get_reclaimer_state() const noexcept
+{
+    //      ,      ;          
+    auto const reclaimer_state_address = reinterpret_cast<uintptr_t>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1) + 1);
+
+    return *reinterpret_cast<reclaimer_state *>((reclaimer_state_address + alignof(reclaimer_state) - 1) & ~(alignof(reclaimer_state) - 1));
+}
+
+allocator_deferred_deallocation::buffer_slot &allocator_deferred_deallocation::get_buffer_slot(
+    size_t position) const noexcept
+{
+    auto &state = get_reclaimer_state();
+
+    return reinterpret_cast<buffer_slot *>(&state + 1)[position & (state.buffer_capacity - 1)];
+}
+
+bool allocator_deferred_deallocation::try_enqueue(
+    void *block_address)
+{
+    auto &state = get_reclaimer_state();
+    auto position = state.enqueue_position.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        auto &slot = get_buffer_slot(position);
+        auto const difference = static_cast<std::ptrdiff_t>(slot.sequence.load(std::memory_order_acquire) - position);
+
+        if (difference < 0)
+        {
+            //        :  
+            return false;
+        }
+
+        if (difference > 0)
+        {
+            position = state.enqueue_position.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (state.enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        {
+            slot.block = block_address;
+            slot.enqueued_at_nanoseconds = get_steady_clock_nanoseconds();
+            slot.sequence.store(position + 1, std::memory_order_release);
+
+            return true;
+        }
+    }
+}
+
+void allocator_deferred_deallocation::reclaim_enqueued_blocks(
+    void **batch)
+{
+    auto &state = get_reclaimer_state();
+
+    for (;;)
+    {
+        size_t blocks_count = 0;
+        auto oldest_enqueued_at_nanoseconds = get_steady_clock_nanoseconds();
+
+        while (blocks_count < state.batch_size)
+        {
+            auto &slot = get_buffer_slot(state.dequeue_position);
+
+            if (slot.sequence.load(std::memory_order_acquire) != state.dequeue_position + 1)
+            {
+                break;
+            }
+
+            batch[blocks_count++] = slot.block;
+            oldest_enqueued_at_nanoseconds = std::min(oldest_enqueued_at_nanoseconds, slot.enqueued_at_nanoseconds);
+
+            slot.sequence.store(state.dequeue_position + state.buffer_capacity, std::memory_order_release);
+            state.dequeue_position++;
+        }
+
+        if (blocks_count == 0)
+        {
+            return;
+        }
+
+        //             
+        std::sort(batch, batch + blocks_count);
+
+        {
+            std::lock_guard<std::mutex> backing_allocator_lock(state.backing_allocator_mutex);
+            get_allocator()->deallocate_batch(batch, blocks_count);
+        }
+
+        auto const reclaim_lag_nanoseconds = get_steady_clock_nanoseconds() - oldest_enqueued_at_nanoseconds;
+
+        state.last_batch_reclaim_lag_nanoseconds.store(reclaim_lag_nanoseconds, std::memory_order_relaxed);
+
+        if (reclaim_lag_nanoseconds > state.max_reclaim_lag_nanoseconds.load(std::memory_order_relaxed))
+        {
+            state.max_reclaim_lag_nanoseconds.store(reclaim_lag_nanoseconds, std::memory_order_relaxed);
+        }
+
+        state.reclaimed_blocks_count.fetch_add(blocks_count, std::memory_order_release);
+    }
+}
+
+void allocator_deferred_deallocation::run_reclaimer()
+{
+    auto &state = get_reclaimer_state();
+    std::vector<void *> batch(state.batch_size);
+
+    std::unique_lock<std::mutex> reclaimer_lock(state.reclaimer_mutex);
+
+    for (;;)
+    {
+        state.reclaimer_wakeup.wait_for(reclaimer_lock, state.reclaim_interval, [&state]()
+        {
+            return state.stop_requested
+                || state.flush_requested
+                || state.enqueue_position.load(std::memory_order_relaxed) - state.reclaimed_blocks_count.load(std::memory_order_relaxed) >= state.batch_size;
+        });
+
+        auto const stop_requested = state.stop_requested;
+        state.flush_requested = false;
+
+        reclaimer_lock.unlock();
+        reclaim_enqueued_blocks(batch.data());
+        reclaimer_lock.lock();
+
+        state.blocks_reclaimed.notify_all();
+
+        if (stop_requested)
+        {
+            return;
+        }
+    }
+}
+
+void allocator_deferred_deallocation::deallocate_deferred(
+    void *block_to_deallocate_address)
+{
+    auto &state = get_reclaimer_state();
+
+    if (!try_enqueue(block_to_deallocate_address))
+    {
+        state.synchronous_deallocations_count.fetch_add(1, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> backing_allocator_lock(state.backing_allocator_mutex);
+        deallocate_with_guard(block_to_deallocate_address);
+        return;
+    }
+
+    //    ;   ,     ,       
+    if (state.enqueue_position.load(std::memory_order_relaxed) - state.reclaimed_blocks_count.load(std::memory_order_relaxed) >= state.batch_size)
+    {
+        //   :              
+        {
+            std::lock_guard<std::mutex> reclaimer_lock(state.reclaimer_mutex);
+            state.flush_requested = true;
+        }
+
+        state.reclaimer_wakeup.notify_one();
+    }
+}
+
+void allocator_deferred_deallocation::flush()
+{
+    auto &state = get_reclaimer_state();
+
+    {
+        std::lock_guard<std::mutex> reclaimer_lock(state.reclaimer_mutex);
+        state.flush_requested = true;
+    }
+
+    state.reclaimer_wakeup.notify_one();
+}
+
+void allocator_deferred_deallocation::synchronize()
+{
+    auto &state = get_reclaimer_state();
+    auto const enqueue_position = state.enqueue_position.load(std::memory_order_acquire);
+
+    std::unique_lock<std::mutex> reclaimer_lock(state.reclaimer_mutex);
+
+    state.flush_requested = true;
+    state.reclaimer_wakeup.notify_one();
+
+    state.blocks_reclaimed.wait(reclaimer_lock, [&state, enqueue_position]()
+    {
+        return state.reclaimed_blocks_count.load(std::memory_order_acquire) >= enqueue_position;
+    });
+}
+
+allocator_deferred_deallocation::deferred_deallocation_metrics allocator_deferred_deallocation::get_metrics() const
+{
+    auto const &state = get_reclaimer_state();
+
+    //    ,       
+    auto const reclaimed_blocks_count = state.reclaimed_blocks_count.load(std::memory_order_acquire);
+    auto const enqueue_position = state.enqueue_position.load(std::memory_order_acquire);
+
+    return deferred_deallocation_metrics
+    {
+        enqueue_position - reclaimed_blocks_count,
+        reclaimed_blocks_count,
+        state.synchronous_deallocations_count.load(std::memory_order_relaxed),
+        state.last_batch_reclaim_lag_nanoseconds.load(std::memory_order_relaxed),
+        state.max_reclaim_lag_nanoseconds.load(std::memory_order_relaxed)
+    };
+}
+
+size_t allocator_deferred_deallocation::get_natural_alignment() const noexcept
+{
+    return get_natural_alignment_with_guard();
+}
+
+void *allocator_deferred_deallocation::allocate(
+    size_t requested_block_size)
+{
+    std::lock_guard<std::mutex> backing_allocator_lock(get_reclaimer_state().backing_allocator_mutex);
+    return allocate_with_guard(requested_block_size);
+}
+
+void allocator_deferred_deallocation::deallocate(
+    void *block_to_deallocate_address)
+{
+    std::lock_guard<std::mutex> backing_allocator_lock(get_reclaimer_state().backing_allocator_mutex);
+    deallocate_with_guard(block_to_deallocate_address);
+}
+
+void *allocator_deferred_deallocation::reallocate(
+    void *block_to_reallocate_address,
+    size_t new_block_size)
+{
+    std::lock_guard<std::mutex> backing_allocator_lock(get_reclaimer_state().backing_allocator_mutex);
+    return get_allocator()->reallocate(block_to_reallocate_address, new_block_size);
+}
+
+bool allocator_deferred_deallocation::reallocate(
+    void **block_to_reallocate_address_address,
+    size_t new_block_size)
+{
+    try {
+        *block_to_reallocate_address_address = reallocate(*block_to_reallocate_address_address, new_block_size);
+        return true;
+    }
+    catch (std::exception const &ex)
+    {
+        this->warning_with_guard(ex.what());
+        return false;
+    }
+}
+
+logger *allocator_deferred_deallocation::get_logger() const noexcept
+{
+    return *reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1);
+}
+
+std::string allocator_deferred_deallocation::get_typename() const noexcept
+{
+    return "allocator_deferred_deallocation";
+}
+
+allocator *allocator_deferred_deallocation::get_allocator() const noexcept
+{
+    return *reinterpret_cast<allocator **>(_trusted_memory);
+}
\ No newline at end of file
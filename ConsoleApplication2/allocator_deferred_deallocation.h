@@ -0,0 +1,154 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_DEFERRED_DEALLOCATION_H
+#define DATA_STRUCTURES_CPP_MEMORY_WITH_DEFERRED_DEALLOCATION_H
+
+#include "typename_holder.h"
+#include "logger.h"
+#include "logger_holder.h"
+#include "allocator.h"
+#include "allocator_holder.h"
+
+class allocator_deferred_deallocation final:
+    public allocator,
+    protected logger_holder,
+    protected typename_holder,
+    protected allocator_holder
+{
+
+public:
+
+    //  .
+    struct deferred_deallocation_metrics
+    {
+        // ,   deallocate_deferred,      
+        size_t queue_depth;
+
+        // ,     
+        size_t reclaimed_blocks_count;
+
+        // ,   -  
+        size_t synchronous_deallocations_count;
+
+        //           ( )
+        size_t last_batch_reclaim_lag_nanoseconds;
+
+        //           ( )
+        size_t max_reclaim_lag_nanoseconds;
+    };
+
+private:
+
+    //  : ,  ,      (  allocator_deferred_deallocation.cpp).
+    struct reclaimer_state;
+
+    //     (  allocator_deferred_deallocation.cpp).
+    struct buffer_slot;
+
+private:
+
+    void *_trusted_memory;
+
+public:
+
+    //   backing_allocator   ,     deallocate_deferred
+    //     batch_size .   buffer_capacity  ( );
+    //     ,      reclaim_interval_milliseconds .
+    explicit allocator_deferred_deallocation(
+        allocator *backing_allocator,
+        logger *logger = nullptr,
+        size_t buffer_capacity = 4096,
+        size_t batch_size = 256,
+        size_t reclaim_interval_milliseconds = 1);
+
+    allocator_deferred_deallocation(
+        allocator_deferred_deallocation const &other) = delete;
+
+    allocator_deferred_deallocation &operator=(
+        allocator_deferred_deallocation const &other) = delete;
+
+    // .    ,       .
+    ~allocator_deferred_deallocation() noexcept;
+
+private:
+
+    //        .
+    [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override;
+
+    //       (    ).
+    [[nodiscard]] size_t get_occupied_block_service_block_size() const noexcept override;
+
+    //   .
+    [[nodiscard]] reclaimer_state &get_reclaimer_state() const noexcept;
+
+    //  ,   position.
+    [[nodiscard]] buffer_slot &get_buffer_slot(
+        size_t position) const noexcept;
+
+    //     ;  false,   .
+    [[nodiscard]] bool try_enqueue(
+        void *block_address);
+
+    //         (  ).
+    void reclaim_enqueued_blocks(
+        void **batch);
+
+    //  .
+    void run_reclaimer();
+
+public:
+
+    //         ;      .
+    void deallocate_deferred(
+        void *block_to_deallocate_address);
+
+    //  ,    .
+    void flush();
+
+    //     ,   .
+    void synchronize();
+
+    //    .
+    [[nodiscard]] deferred_deallocation_metrics get_metrics() const;
+
+public:
+
+    //    ,    .
+    [[nodiscard]] size_t get_natural_alignment() const noexcept override;
+
+    //     requested_block_size   .
+    void *allocate(
+        size_t requested_block_size) override;
+
+    using allocator::deallocate;
+
+    //    .
+    void deallocate(
+        void *block_to_deallocate_address) override;
+
+    //     .
+    [[nodiscard]] void *reallocate(
+        void *block_to_reallocate_address,
+        size_t new_block_size) override;
+
+    //      .    ,    .
+    bool reallocate(
+        void **block_to_reallocate_address_address,
+        size_t new_block_size) override;
+
+private:
+
+    //    logger,    .
+    [[nodiscard]] logger *get_logger() const noexcept override;
+
+private:
+
+    //     (allocator_deferred_deallocation).
+    [[nodiscard]] std::string get_typename() const noexcept override;
+
+private:
+
+    //    .
+    [[nodiscard]] allocator *get_allocator() const noexcept override;
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_WITH_DEFERRED_DEALLOCATION_H
\ No newline at end of file
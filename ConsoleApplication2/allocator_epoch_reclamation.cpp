@@ -0,0 +1,503 @@
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "allocator_epoch_reclamation.h"
+
+struct allocator_epoch_reclamation::thread_record
+{
+    //,   ;    
+    std::atomic<allocator_epoch_reclamation *> owner;
+
+    //      owner
+    thread_record *next;
+
+    //,        (_quiescent_epoch   )
+    std::atomic<size_t> announced_epoch;
+
+    size_t critical_sections_nesting_depth;
+
+    // :      reclaim  
+    bool abandoned;
+
+    size_t retires_since_reclamation_count;
+
+    //   ,      (  ,     )
+    std::vector<void *> retired_blocks;
+
+    std::vector<size_t> retired_blocks_epochs;
+};
+
+struct allocator_epoch_reclamation::thread_records_holder
+{
+    std::vector<thread_record *> records;
+
+    ~thread_records_holder() noexcept;
+};
+
+namespace
+{
+
+    //,      allocator_epoch_reclamation.
+    std::mutex &get_thread_records_registry_mutex()
+    {
+        static std::mutex registry_mutex;
+        return registry_mutex;
+    }
+
+}
+
+allocator_epoch_reclamation::thread_records_holder::~thread_records_holder() noexcept
+{
+    std::lock_guard<std::mutex> registry_lock(get_thread_records_registry_mutex());
+
+    for (auto *record : records)
+    {
+        auto *owner = record->owner.load(std::memory_order_relaxed);
+
+        if (owner == nullptr)
+        {
+            delete record;
+            continue;
+        }
+
+        record->announced_epoch.store(_quiescent_epoch, std::memory_order_release);
+        owner->reclaim_thread_record(record);
+
+        if (!record->retired_blocks.empty())
+        {
+            //        reclaim   
+            record->abandoned = true;
+            continue;
+        }
+
+        auto **record_address_address = owner->get_first_thread_record_address_address();
+        while (*record_address_address != record)
+        {
+            record_address_address = &(*record_address_address)->next;
+        }
+
+        *record_address_address = record->next;
+
+        delete record;
+    }
+}
+
+allocator_epoch_reclamation::allocator_epoch_reclamation(
+    allocator *backing_allocator,
+    logger *log,
+    size_t retire_list_capacity,
+    size_t reclamation_period)
+{
+    auto got_typename = get_typename();
+
+    if (log != nullptr)
+    {
+        log->trace(got_typename + " allocator instance construction started")
+            ->debug("retire list capacity: " + std::to_string(retire_list_capacity) + " blocks, reclamation period: " + std::to_string(reclamation_period) + " retires");
+    }
+
+    if (backing_allocator == nullptr || reclamation_period == 0 || reclamation_period > retire_list_capacity)
+    {
+        auto error_message = "backing allocator should be set and reclamation period should be GT 0 and LE retire list capacity";
+
+        if (log != nullptr)
+        {
+            log->error(error_message);
+        }
+
+        throw std::invalid_argument(error_message);
+    }
+
+    _trusted_memory = backing_allocator->allocate(get_allocator_service_block_size());
+
+    auto * const backing_allocator_pointer_space = reinterpret_cast<allocator **>(_trusted_memory);
+    *backing_allocator_pointer_space = backing_allocator;
+
+    auto * const logger_pointer_space = reinterpret_cast<logger **>(backing_allocator_pointer_space + 1);
+    *logger_pointer_space = log;
+
+    auto * const retire_list_capacity_space = reinterpret_cast<size_t *>(logger_pointer_space + 1);
+    *retire_list_capacity_space = retire_list_capacity;
+
+    auto * const reclamation_period_space = retire_list_capacity_space + 1;
+    *reclamation_period_space = reclamation_period;
+
+    auto * const first_thread_record_pointer_space = reinterpret_cast<thread_record **>(reclamation_period_space + 1);
+    *first_thread_record_pointer_space = nullptr;
+
+    new (first_thread_record_pointer_space + 1) std::atomic<size_t>(0);
+
+    new (&get_global_epoch() + 1) std::mutex();
+
+    this->trace_with_guard(got_typename + " allocator instance construction finished");
+}
+
+allocator_epoch_reclamation::~allocator_epoch_reclamation() noexcept
+{
+    auto got_typename = get_typename();
+    this->trace_with_guard(got_typename + " allocator instance destruction started");
+
+    auto const * const logger = get_logger();
+
+    {
+        std::lock_guard<std::mutex> registry_lock(get_thread_records_registry_mutex());
+
+        for (auto *record = *get_first_thread_record_address_address(); record != nullptr; )
+        {
+            auto *next_record = record->next;
+
+            reclaim_thread_record_unconditionally(record);
+
+            //          
+            if (record->abandoned)
+            {
+                delete record;
+            }
+            else
+            {
+                record->owner.store(nullptr, std::memory_order_relaxed);
+            }
+
+            record = next_record;
+        }
+    }
+
+    get_backing_allocator_mutex().~mutex();
+
+    deallocate_with_guard(_trusted_memory);
+
+    if (logger != nullptr)
+    {
+        logger->trace(got_typename + " allocator instance destruction finished");
+    }
+}
+
+size_t allocator_epoch_reclamation::get_allocator_service_block_size() const noexcept
+{
+    auto const backing_allocator_pointer_size = sizeof(allocator *);
+    auto const logger_pointer_size = sizeof(logger *);
+    auto const retire_list_capacity_size = sizeof(size_t);
+    auto const reclamation_period_size = sizeof(size_t);
+    auto const first_thread_record_pointer_size = sizeof(thread_record *);
+    auto const global_epoch_size = sizeof(std::atomic<size_t>);
+    auto const backing_allocator_mutex_size = sizeof(std::mutex);
+
+    return backing_allocator_pointer_size + logger_pointer_size + retire_list_capacity_size + reclamation_period_size + first_thread_record_pointer_size + global_epoch_size + backing_allocator_mutex_size;
+}
+
+size_t allocator_epoch_reclamation::get_occupied_block_service_block_size() const noexcept
+{
+    return 0;
+}
+
+size_t allocator_epoch_reclamation::get_retire_list_capacity() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1) + 1);
+}
+
+size_t allocator_epoch_reclamation::get_reclamation_period() const noexcept
+{
+    return *(reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1) + 1) + 1);
+}
+
+allocator_epoch_reclamation::thread_record **allocator_epoch_reclamation::get_first_thread_record_address_address() const noexcept
+{
+    return reinterpret_cast<thread_record **>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(allocator *) + sizeof(logger *) + sizeof(size_t) + sizeof(size_t));
+}
+
+std::atomic<size_t> &allocator_epoch_reclamation::get_global_epoch() const noexcept
+{
+    return *reinterpret_cast<std::atomic<size_t> *>(get_first_thread_record_address_address() + 1);
+}
+
+std::mutex &allocator_epoch_reclamation::get_backing_allocator_mutex() const noexcept
+{
+    return *reinterpret_cast<std::mutex *>(&get_global_epoch() + 1);
+}
+
+allocator_epoch_reclamation::thread_record *allocator_epoch_reclamation::get_current_thread_record()
+{
+    static thread_local thread_records_holder holder;
+
+    for (auto *record : holder.records)
+    {
+        if (record->owner.load(std::memory_order_relaxed) == this)
+        {
+            return record;
+        }
+    }
+
+    this->trace_with_guard("Creating thread record for " + get_typename() + " at " + address_to_hex(this));
+
+    std::lock_guard<std::mutex> registry_lock(get_thread_records_registry_mutex());
+
+    //       ,  
+    holder.records.erase(std::remove_if(holder.records.begin(), holder.records.end(), [](thread_record *record)
+    {
+        if (record->owner.load(std::memory_order_relaxed) != nullptr)
+        {
+            return false;
+        }
+
+        delete record;
+        return true;
+    }), holder.records.end());
+
+    auto *record = new thread_record;
+    record->owner.store(this, std::memory_order_relaxed);
+    record->announced_epoch.store(_quiescent_epoch, std::memory_order_relaxed);
+    record->critical_sections_nesting_depth = 0;
+    record->abandoned = false;
+    record->retires_since_reclamation_count = 0;
+    record->retired_blocks.reserve(get_retire_list_capacity());
+    record->retired_blocks_epochs.reserve(get_retire_list_capacity());
+
+    auto **first_thread_record_address_address = get_first_thread_record_address_address();
+    record->next = *first_thread_record_address_address;
+    *first_thread_record_address_address = record;
+
+    holder.records.push_back(record);
+
+    return record;
+}
+
+void allocator_epoch_reclamation::try_advance_global_epoch()
+{
+    auto &global_epoch = get_global_epoch();
+    auto epoch = global_epoch.load(std::memory_order_seq_cst);
+
+    {
+        std::lock_guard<std::mutex> registry_lock(get_thread_records_registry_mutex());
+
+        for (auto *record = *get_first_thread_record_address_address(); record != nullptr; record = record->next)
+        {
+            auto const announced_epoch = record->announced_epoch.load(std::memory_order_seq_cst);
+
+            if (announced_epoch != _quiescent_epoch && announced_epoch != epoch)
+            {
+                return;
+            }
+        }
+    }
+
+    global_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+}
+
+void allocator_epoch_reclamation::reclaim_thread_record(
+    thread_record *record)
+{
+    //,    e,         e - 1  e,    e + 2
+    auto const global_epoch = get_global_epoch().load(std::memory_order_seq_cst);
+    auto const &retired_blocks_epochs = record->retired_blocks_epochs;
+    size_t reclaimed_blocks_count = 0;
+
+    while (reclaimed_blocks_count < retired_blocks_epochs.size() && retired_blocks_epochs[reclaimed_blocks_count] + 2 <= global_epoch)
+    {
+        reclaimed_blocks_count++;
+    }
+
+    if (reclaimed_blocks_count == 0)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+        get_allocator()->deallocate_batch(record->retired_blocks.data(), reclaimed_blocks_count);
+    }
+
+    record->retired_blocks.erase(record->retired_blocks.begin(), record->retired_blocks.begin() + reclaimed_blocks_count);
+    record->retired_blocks_epochs.erase(record->retired_blocks_epochs.begin(), record->retired_blocks_epochs.begin() + reclaimed_blocks_count);
+}
+
+void allocator_epoch_reclamation::reclaim_thread_record_unconditionally(
+    thread_record *record)
+{
+    if (!record->retired_blocks.empty())
+    {
+        std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+        get_allocator()->deallocate_batch(record->retired_blocks.data(), record->retired_blocks.size());
+    }
+
+    record->retired_blocks.clear();
+    record->retired_blocks_epochs.clear();
+}
+
+void allocator_epoch_reclamation::enter_critical_section()
+{
+    auto *record = get_current_thread_record();
+
+    if (record->critical_sections_nesting_depth++ != 0)
+    {
+        return;
+    }
+
+    //  ,        
+    auto &global_epoch = get_global_epoch();
+    auto epoch = global_epoch.load(std::memory_order_seq_cst);
+
+    for (;;)
+    {
+        record->announced_epoch.store(epoch, std::memory_order_seq_cst);
+
+        auto const current_epoch = global_epoch.load(std::memory_order_seq_cst);
+
+        if (current_epoch == epoch)
+        {
+            break;
+        }
+
+        epoch = current_epoch;
+    }
+}
+
+void allocator_epoch_reclamation::leave_critical_section()
+{
+    auto *record = get_current_thread_record();
+
+    if (record->critical_sections_nesting_depth == 0)
+    {
+        auto const error_message = "leaving critical section that was not entered";
+
+        this->error_with_guard(error_message);
+
+        throw std::logic_error(error_message);
+    }
+
+    if (--record->critical_sections_nesting_depth == 0)
+    {
+        record->announced_epoch.store(_quiescent_epoch, std::memory_order_release);
+    }
+}
+
+void allocator_epoch_reclamation::retire(
+    void *block_to_retire_address)
+{
+    auto *record = get_current_thread_record();
+    auto const retire_list_capacity = get_retire_list_capacity();
+
+    if (record->retired_blocks.size() == retire_list_capacity)
+    {
+        try_advance_global_epoch();
+        reclaim_thread_record(record);
+
+        while (record->retired_blocks.size() == retire_list_capacity)
+        {
+            //             
+            if (record->critical_sections_nesting_depth != 0)
+            {
+                auto const warning_message = "retire list is full";
+
+                this->warning_with_guard(warning_message);
+
+                throw memory_exception(warning_message);
+            }
+
+            std::this_thread::yield();
+
+            try_advance_global_epoch();
+            reclaim_thread_record(record);
+        }
+    }
+
+    record->retired_blocks.push_back(block_to_retire_address);
+    record->retired_blocks_epochs.push_back(get_global_epoch().load(std::memory_order_seq_cst));
+
+    if (++record->retires_since_reclamation_count == get_reclamation_period())
+    {
+        record->retires_since_reclamation_count = 0;
+
+        try_advance_global_epoch();
+        reclaim_thread_record(record);
+    }
+}
+
+void allocator_epoch_reclamation::reclaim()
+{
+    auto *record = get_current_thread_record();
+
+    try_advance_global_epoch();
+    reclaim_thread_record(record);
+
+    std::lock_guard<std::mutex> registry_lock(get_thread_records_registry_mutex());
+
+    auto **record_address_address = get_first_thread_record_address_address();
+
+    while (*record_address_address != nullptr)
+    {
+        auto *current_record = *record_address_address;
+
+        if (current_record->abandoned)
+        {
+            reclaim_thread_record(current_record);
+
+            if (current_record->retired_blocks.empty())
+            {
+                *record_address_address = current_record->next;
+                delete current_record;
+                continue;
+            }
+        }
+
+        record_address_address = &current_record->next;
+    }
+}
+
+size_t allocator_epoch_reclamation::get_natural_alignment() const noexcept
+{
+    return get_natural_alignment_with_guard();
+}
+
+void *allocator_epoch_reclamation::allocate(
+    size_t requested_block_size)
+{
+    std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+    return allocate_with_guard(requested_block_size);
+}
+
+void allocator_epoch_reclamation::deallocate(
+    void *block_to_deallocate_address)
+{
+    std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+    deallocate_with_guard(block_to_deallocate_address);
+}
+
+void *allocator_epoch_reclamation::reallocate(
+    void *block_to_reallocate_address,
+    size_t new_block_size)
+{
+    std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+    return get_allocator()->reallocate(block_to_reallocate_address, new_block_size);
+}
+
+bool allocator_epoch_reclamation::reallocate(
+    void **block_to_reallocate_address_address,
+    size_t new_block_size)
+{
+    try {
+        *block_to_reallocate_address_address = reallocate(*block_to_reallocate_address_address, new_block_size);
+        return true;
+    }
+    catch (std::exception const &ex)
+    {
+        this->warning_with_guard(ex.what());
+        return false;
+    }
+}
+
+logger *allocator_epoch_reclamation::get_logger() const noexcept
+{
+    return *reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1);
+}
+
+std::string allocator_epoch_reclamation::get_typename() const noexcept
+{
+    return "allocator_epoch_reclamation";
+}
+
+allocator *allocator_epoch_reclamation::get_allocator() const noexcept
+{
+    return *reinterpret_cast<allocator **>(_trusted_memory);
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_EPOCH_RECLAMATION_H
+#define DATA_STRUCTURES_CPP_MEMORY_WITH_EPOCH_RECLAMATION_H
+
+#include <atomic>
+#include <mutex>
+#include "typename_holder.h"
+#include "logger.h"
+#include "logger_holder.h"
+#include "allocator.h"
+#include "allocator_holder.h"
+
+class allocator_epoch_reclamation final:
+    public allocator,
+    protected logger_holder,
+    protected typename_holder,
+    protected allocator_holder
+{
+
+private:
+
+    //   ,    .
+    static constexpr size_t _quiescent_epoch = static_cast<size_t>(-1);
+
+    //     allocator_epoch_reclamation:       (  allocator_epoch_reclamation.cpp).
+    struct thread_record;
+
+    //   ,      .
+    struct thread_records_holder;
+
+private:
+
+    void *_trusted_memory;
+
+public:
+
+    //   backing_allocator,   ,   retire,    ,
+    //    .      retire_list_capacity ;
+    // reclamation_period  retire          .
+    explicit allocator_epoch_reclamation(
+        allocator *backing_allocator,
+        logger *logger = nullptr,
+        size_t retire_list_capacity = 1024,
+        size_t reclamation_period = 128);
+
+    allocator_epoch_reclamation(
+        allocator_epoch_reclamation const &other) = delete;
+
+    allocator_epoch_reclamation &operator=(
+        allocator_epoch_reclamation const &other) = delete;
+
+    // .      ;        .
+    ~allocator_epoch_reclamation() noexcept;
+
+private:
+
+    //     .
+    [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override;
+
+    //       (    ).
+    [[nodiscard]] size_t get_occupied_block_service_block_size() const noexcept override;
+
+    //       .
+    [[nodiscard]] size_t get_retire_list_capacity() const noexcept;
+
+    //   retire      .
+    [[nodiscard]] size_t get_reclamation_period() const noexcept;
+
+    //           .
+    [[nodiscard]] thread_record **get_first_thread_record_address_address() const noexcept;
+
+    //  .
+    [[nodiscard]] std::atomic<size_t> &get_global_epoch() const noexcept;
+
+    // ,       .
+    [[nodiscard]] std::mutex &get_backing_allocator_mutex() const noexcept;
+
+    //      ,     .
+    [[nodiscard]] thread_record *get_current_thread_record();
+
+    //  ,         .
+    void try_advance_global_epoch();
+
+    //       record,      .
+    void reclaim_thread_record(
+        thread_record *record);
+
+    //      record,   .
+    void reclaim_thread_record_unconditionally(
+        thread_record *record);
+
+public:
+
+    //     ; ,   retire  ,       .
+    //      .
+    void enter_critical_section();
+
+    //     .
+    void leave_critical_section();
+
+    //   block_to_retire_address          .
+    //        ,      ,
+    //   -  memory_exception,   .
+    void retire(
+        void *block_to_retire_address);
+
+    //             .
+    void reclaim();
+
+public:
+
+    //    :     .
+    [[nodiscard]] size_t get_natural_alignment() const noexcept override;
+
+    //     requested_block_size   .
+    void *allocate(
+        size_t requested_block_size) override;
+
+    using allocator::deallocate;
+
+    //    ,       .
+    void deallocate(
+        void *block_to_deallocate_address) override;
+
+    //  ,       ,   .
+    [[nodiscard]] void *reallocate(
+        void *block_to_reallocate_address,
+        size_t new_block_size) override;
+
+    //      .    ,    .
+    bool reallocate(
+        void **block_to_reallocate_address_address,
+        size_t new_block_size) override;
+
+private:
+
+    //    logger,    .
+    [[nodiscard]] logger *get_logger() const noexcept override;
+
+private:
+
+    //     (allocator_epoch_reclamation).
+    [[nodiscard]] std::string get_typename() const noexcept override;
+
+private:
+
+    //    .
+    [[nodiscard]] allocator *get_allocator() const noexcept override;
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_WITH_EPOCH_RECLAMATION_H
\ No newline at end of file
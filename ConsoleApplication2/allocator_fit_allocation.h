@@ -13,7 +13,9 @@ public:
     {
         first_fit,
         the_best_fit,
-        the_worst_fit
+        the_worst_fit,
+        segregated_fit,
+        next_fit
     };
 
 public:
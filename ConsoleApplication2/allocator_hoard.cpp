@@ -0,0 +1,613 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include "allocator_hoard.h"
+
+struct allocator_hoard::heap
+{
+    //,        
+    std::mutex mutex;
+
+    //     :    
+    superblock *superblocks[_size_classes_count];
+
+    heap_statistics statistics;
+};
+
+struct allocator_hoard::superblock
+{
+    // -;     -   
+    std::atomic<size_t> owner_heap_index;
+
+    size_t size_class_index;
+
+    size_t objects_count;
+
+    size_t used_objects_count;
+
+    //  ,      
+    void *available_objects;
+
+    superblock *previous;
+
+    superblock *next;
+};
+
+namespace
+{
+
+    // ,   ;       .
+    std::atomic<size_t> threads_with_heap_count(0);
+
+    // ,    (      allocator_hoard).
+    thread_local size_t current_thread_heap_index = threads_with_heap_count.fetch_add(1, std::memory_order_relaxed);
+
+}
+
+allocator_hoard::allocator_hoard(
+    size_t heaps_count,
+    allocator *outer_allocator,
+    logger *log,
+    size_t superblock_size,
+    size_t fullness_threshold_percent)
+{
+    auto got_typename = get_typename();
+
+    if (log != nullptr)
+    {
+        log->trace(got_typename + " allocator instance construction started")
+            ->debug("requested " + std::to_string(heaps_count) + " heaps, superblock size: " + std::to_string(superblock_size) + " bytes, fullness threshold: " + std::to_string(fullness_threshold_percent) + "%");
+    }
+
+    if (heaps_count == 0 || superblock_size < _minimal_superblock_size || fullness_threshold_percent > 100)
+    {
+        auto error_message = "heaps count should be GT 0, superblock size should be GE " + std::to_string(_minimal_superblock_size) + " bytes and fullness threshold should be LE 100%";
+
+        if (log != nullptr)
+        {
+            log->error(error_message);
+        }
+
+        throw std::invalid_argument(error_message);
+    }
+
+    //    ,         
+    auto const allocator_service_block_size = sizeof(allocator *) + sizeof(logger *) + 3 * sizeof(size_t) + _heap_alignment - 1 + (heaps_count + 1) * get_heap_size();
+
+    _trusted_memory = outer_allocator == nullptr
+        ? ::operator new(allocator_service_block_size)
+        : outer_allocator->allocate(allocator_service_block_size);
+
+    auto * const outer_allocator_pointer_space = reinterpret_cast<allocator **>(_trusted_memory);
+    *outer_allocator_pointer_space = outer_allocator;
+
+    auto * const logger_pointer_space = reinterpret_cast<logger **>(outer_allocator_pointer_space + 1);
+    *logger_pointer_space = log;
+
+    auto * const superblock_size_space = reinterpret_cast<size_t *>(logger_pointer_space + 1);
+    *superblock_size_space = superblock_size;
+
+    auto * const heaps_count_space = superblock_size_space + 1;
+    *heaps_count_space = heaps_count;
+
+    auto * const fullness_threshold_percent_space = heaps_count_space + 1;
+    *fullness_threshold_percent_space = fullness_threshold_percent;
+
+    for (size_t heap_index = 0; heap_index <= heaps_count; heap_index++)
+    {
+        auto *current_heap = new (&get_heap(heap_index)) heap;
+        std::fill(current_heap->superblocks, current_heap->superblocks + _size_classes_count, nullptr);
+        current_heap->statistics = heap_statistics { 0, 0, 0, 0 };
+    }
+
+    this->trace_with_guard(got_typename + " allocator instance construction finished");
+}
+
+allocator_hoard::~allocator_hoard() noexcept
+{
+    auto got_typename = get_typename();
+    this->trace_with_guard(got_typename + " allocator instance destruction started");
+
+    auto const * const logger = get_logger();
+
+    for (size_t heap_index = 0; heap_index <= get_heaps_count(); heap_index++)
+    {
+        auto &current_heap = get_heap(heap_index);
+
+        for (auto *first_superblock : current_heap.superblocks)
+        {
+            if (first_superblock == nullptr)
+            {
+                continue;
+            }
+
+            auto *current_superblock = first_superblock;
+
+            do
+            {
+                auto *next_superblock = current_superblock->next;
+
+                current_superblock->~superblock();
+                deallocate_with_guard(current_superblock);
+
+                current_superblock = next_superblock;
+            }
+            while (current_superblock != first_superblock);
+        }
+
+        current_heap.~heap();
+    }
+
+    deallocate_with_guard(_trusted_memory);
+
+    if (logger != nullptr)
+    {
+        logger->trace(got_typename + " allocator instance destruction finished");
+    }
+}
+
+size_t allocator_hoard::get_allocator_service_block_size() const noexcept
+{
+    auto const outer_allocator_pointer_size = sizeof(allocator *);
+    auto const logger_pointer_size = sizeof(logger *);
+    auto const superblock_size_size = sizeof(size_t);
+    auto const heaps_count_size = sizeof(size_t);
+    auto const fullness_threshold_percent_size = sizeof(size_t);
+    auto const heaps_alignment_size = _heap_alignment - 1;
+    auto const heaps_size = (get_heaps_count() + 1) * get_heap_size();
+
+    return outer_allocator_pointer_size + logger_pointer_size + superblock_size_size + heaps_count_size + fullness_threshold_percent_size + heaps_alignment_size + heaps_size;
+}
+
+size_t allocator_hoard::get_occupied_block_service_block_size() const noexcept
+{
+    auto const superblock_pointer_size = sizeof(superblock *);
+
+    return superblock_pointer_size;
+}
+
+size_t allocator_hoard::get_superblock_size() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1) + 1);
+}
+
+size_t allocator_hoard::get_heaps_count() const noexcept
+{
+    return *(reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1) + 1) + 1);
+}
+
+size_t allocator_hoard::get_fullness_threshold_percent() const noexcept
+{
+    return *(reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1) + 1) + 2);
+}
+
+size_t allocator_hoard::get_heap_size() noexcept
+{
+    return (sizeof(heap) + _heap_alignment - 1) & ~(_heap_alignment - 1);
+}
+
+allocator_hoard::heap &allocator_hoard::get_heap(
+    size_t heap_index) const noexcept
+{
+    auto const heaps_address = reinterpret_cast<uintptr_t>(_trusted_memory) + sizeof(allocator *) + sizeof(logger *) + 3 * sizeof(size_t);
+    auto * const first_heap = reinterpret_cast<unsigned char *>((heaps_address + _heap_alignment - 1) & ~(_heap_alignment - 1));
+
+    return *reinterpret_cast<heap *>(first_heap + heap_index * get_heap_size());
+}
+
+size_t allocator_hoard::get_size_class_index(
+    size_t requested_block_size) noexcept
+{
+    size_t size_class_index = 0;
+
+    for (auto size_class = _smallest_size_class; size_class < requested_block_size && size_class_index < _size_classes_count; size_class <<= 1)
+    {
+        size_class_index++;
+    }
+
+    return size_class_index;
+}
+
+size_t allocator_hoard::get_size_class_object_size(
+    size_t size_class_index) noexcept
+{
+    return _smallest_size_class << size_class_index;
+}
+
+unsigned char *allocator_hoard::get_superblock_first_object_address(
+    superblock *block) noexcept
+{
+    auto const first_object_offset = (sizeof(superblock) + _smallest_size_class - 1) & ~(_smallest_size_class - 1);
+
+    return reinterpret_cast<unsigned char *>(block) + first_object_offset;
+}
+
+bool allocator_hoard::is_superblock_sparse(
+    superblock const *block) const noexcept
+{
+    return block->used_objects_count * 100 < get_fullness_threshold_percent() * block->objects_count;
+}
+
+void allocator_hoard::insert_superblock(
+    heap &owner_heap,
+    superblock *block) noexcept
+{
+    auto *&first_superblock = owner_heap.superblocks[block->size_class_index];
+
+    if (first_superblock == nullptr)
+    {
+        block->previous = block->next = block;
+        first_superblock = block;
+        return;
+    }
+
+    //       -    
+    block->next = first_superblock;
+    block->previous = first_superblock->previous;
+    first_superblock->previous->next = block;
+    first_superblock->previous = block;
+
+    if (block->used_objects_count < block->objects_count)
+    {
+        first_superblock = block;
+    }
+}
+
+void allocator_hoard::remove_superblock(
+    heap &owner_heap,
+    superblock *block) noexcept
+{
+    auto *&first_superblock = owner_heap.superblocks[block->size_class_index];
+
+    if (block->next == block)
+    {
+        first_superblock = nullptr;
+        return;
+    }
+
+    block->previous->next = block->next;
+    block->next->previous = block->previous;
+
+    if (first_superblock == block)
+    {
+        first_superblock = block->next;
+    }
+}
+
+allocator_hoard::superblock *allocator_hoard::create_superblock(
+    size_t size_class_index)
+{
+    auto const superblock_size = get_superblock_size();
+    auto *block = new (allocate_with_guard(superblock_size)) superblock;
+
+    block->owner_heap_index.store(0, std::memory_order_relaxed);
+    block->size_class_index = size_class_index;
+    block->used_objects_count = 0;
+    block->available_objects = nullptr;
+
+    //       
+    auto const object_stride = get_occupied_block_service_block_size() + get_size_class_object_size(size_class_index);
+    auto * const first_object_address = get_superblock_first_object_address(block);
+    block->objects_count = (reinterpret_cast<unsigned char *>(block) + superblock_size - first_object_address) / object_stride;
+
+    for (auto object_index = block->objects_count; object_index-- > 0; )
+    {
+        auto * const object_superblock_pointer_space = reinterpret_cast<superblock **>(first_object_address + object_index * object_stride);
+        *object_superblock_pointer_space = block;
+
+        *reinterpret_cast<void **>(object_superblock_pointer_space + 1) = block->available_objects;
+        block->available_objects = object_superblock_pointer_space + 1;
+    }
+
+    return block;
+}
+
+allocator_hoard::superblock *allocator_hoard::take_superblock_from_global_heap(
+    size_t heap_index,
+    size_t size_class_index)
+{
+    auto &global_heap = get_heap(0);
+    auto &thread_heap = get_heap(heap_index);
+
+    std::lock_guard<std::mutex> global_heap_lock(global_heap.mutex);
+
+    auto *block = global_heap.superblocks[size_class_index];
+
+    if (block != nullptr && block->used_objects_count < block->objects_count)
+    {
+        remove_superblock(global_heap, block);
+
+        global_heap.statistics.in_use_size -= block->used_objects_count * get_size_class_object_size(size_class_index);
+        global_heap.statistics.allocated_size -= get_superblock_size();
+        global_heap.statistics.superblocks_migrated_out_count++;
+    }
+    else
+    {
+        block = create_superblock(size_class_index);
+    }
+
+    block->owner_heap_index.store(heap_index, std::memory_order_relaxed);
+    insert_superblock(thread_heap, block);
+
+    thread_heap.statistics.in_use_size += block->used_objects_count * get_size_class_object_size(size_class_index);
+    thread_heap.statistics.allocated_size += get_superblock_size();
+    thread_heap.statistics.superblocks_migrated_in_count++;
+
+    return block;
+}
+
+void allocator_hoard::migrate_superblock_to_global_heap(
+    size_t heap_index,
+    superblock *block)
+{
+    auto &global_heap = get_heap(0);
+    auto &thread_heap = get_heap(heap_index);
+    auto const used_size = block->used_objects_count * get_size_class_object_size(block->size_class_index);
+
+    remove_superblock(thread_heap, block);
+
+    thread_heap.statistics.in_use_size -= used_size;
+    thread_heap.statistics.allocated_size -= get_superblock_size();
+    thread_heap.statistics.superblocks_migrated_out_count++;
+
+    std::lock_guard<std::mutex> global_heap_lock(global_heap.mutex);
+
+    if (block->used_objects_count == 0)
+    {
+        block->~superblock();
+        deallocate_with_guard(block);
+        return;
+    }
+
+    block->owner_heap_index.store(0, std::memory_order_relaxed);
+    insert_superblock(global_heap, block);
+
+    global_heap.statistics.in_use_size += used_size;
+    global_heap.statistics.allocated_size += get_superblock_size();
+    global_heap.statistics.superblocks_migrated_in_count++;
+}
+
+void allocator_hoard::restore_heap_emptiness_invariant(
+    size_t heap_index,
+    superblock *freed_into)
+{
+    auto const &statistics = get_heap(heap_index).statistics;
+    auto const superblock_size = get_superblock_size();
+
+    //     _slack_superblocks_count     ,   
+    if (statistics.in_use_size + _slack_superblocks_count * superblock_size >= statistics.allocated_size
+        || statistics.in_use_size * 100 >= get_fullness_threshold_percent() * statistics.allocated_size)
+    {
+        return;
+    }
+
+    if (is_superblock_sparse(freed_into))
+    {
+        migrate_superblock_to_global_heap(heap_index, freed_into);
+        return;
+    }
+
+    //    -    ,     
+    for (auto *first_superblock : get_heap(heap_index).superblocks)
+    {
+        if (first_superblock != nullptr && is_superblock_sparse(first_superblock))
+        {
+            migrate_superblock_to_global_heap(heap_index, first_superblock);
+            return;
+        }
+    }
+}
+
+allocator_hoard::heap_statistics allocator_hoard::get_heap_statistics(
+    size_t heap_index) const
+{
+    if (heap_index > get_heaps_count())
+    {
+        auto const error_message = "heap index should be LE " + std::to_string(get_heaps_count());
+
+        this->error_with_guard(error_message);
+
+        throw std::invalid_argument(error_message);
+    }
+
+    auto &requested_heap = get_heap(heap_index);
+    std::lock_guard<std::mutex> heap_lock(requested_heap.mutex);
+
+    return requested_heap.statistics;
+}
+
+size_t allocator_hoard::get_natural_alignment() const noexcept
+{
+    return std::min(get_natural_alignment_with_guard(), alignof(size_t));
+}
+
+void *allocator_hoard::allocate(
+    size_t requested_block_size)
+{
+    auto const size_class_index = get_size_class_index(requested_block_size);
+
+    if (size_class_index == _size_classes_count)
+    {
+        // :          
+        size_t *block = nullptr;
+
+        if (requested_block_size <= std::numeric_limits<size_t>::max() - 2 * sizeof(size_t))
+        {
+            std::lock_guard<std::mutex> global_heap_lock(get_heap(0).mutex);
+
+            try
+            {
+                block = reinterpret_cast<size_t *>(allocate_with_guard(2 * sizeof(size_t) + requested_block_size));
+            }
+            catch (std::exception const &)
+            {
+
+            }
+        }
+
+        if (block == nullptr)
+        {
+            auto const warning_message = "no memory available to allocate";
+
+            this->warning_with_guard(warning_message);
+
+            throw memory_exception(warning_message);
+        }
+
+        block[0] = requested_block_size;
+        block[1] = 0;
+
+        return block + 2;
+    }
+
+    auto const heap_index = current_thread_heap_index % get_heaps_count() + 1;
+    auto &thread_heap = get_heap(heap_index);
+
+    std::lock_guard<std::mutex> heap_lock(thread_heap.mutex);
+
+    auto *block = thread_heap.superblocks[size_class_index];
+
+    if (block == nullptr || block->used_objects_count == block->objects_count)
+    {
+        try
+        {
+            block = take_superblock_from_global_heap(heap_index, size_class_index);
+        }
+        catch (std::exception const &)
+        {
+            auto const warning_message = "no memory available to allocate";
+
+            this->warning_with_guard(warning_message);
+
+            throw memory_exception(warning_message);
+        }
+    }
+
+    auto *allocated_object = block->available_objects;
+    block->available_objects = *reinterpret_cast<void **>(allocated_object);
+
+    thread_heap.statistics.in_use_size += get_size_class_object_size(size_class_index);
+
+    //      
+    if (++block->used_objects_count == block->objects_count)
+    {
+        thread_heap.superblocks[size_class_index] = block->next;
+    }
+
+    return allocated_object;
+}
+
+void allocator_hoard::deallocate(
+    void *block_to_deallocate_address)
+{
+    auto *block = *(reinterpret_cast<superblock **>(block_to_deallocate_address) - 1);
+
+    if (block == nullptr)
+    {
+        std::lock_guard<std::mutex> global_heap_lock(get_heap(0).mutex);
+        deallocate_with_guard(reinterpret_cast<size_t *>(block_to_deallocate_address) - 2);
+        return;
+    }
+
+    //   ,      
+    size_t heap_index;
+
+    for (;;)
+    {
+        heap_index = block->owner_heap_index.load(std::memory_order_relaxed);
+        get_heap(heap_index).mutex.lock();
+
+        if (block->owner_heap_index.load(std::memory_order_relaxed) == heap_index)
+        {
+            break;
+        }
+
+        get_heap(heap_index).mutex.unlock();
+    }
+
+    auto &owner_heap = get_heap(heap_index);
+    std::lock_guard<std::mutex> heap_lock(owner_heap.mutex, std::adopt_lock);
+
+    auto const was_full = block->used_objects_count == block->objects_count;
+
+    *reinterpret_cast<void **>(block_to_deallocate_address) = block->available_objects;
+    block->available_objects = block_to_deallocate_address;
+    block->used_objects_count--;
+
+    owner_heap.statistics.in_use_size -= get_size_class_object_size(block->size_class_index);
+
+    if (was_full)
+    {
+        remove_superblock(owner_heap, block);
+        insert_superblock(owner_heap, block);
+    }
+
+    if (heap_index != 0)
+    {
+        restore_heap_emptiness_invariant(heap_index, block);
+    }
+    else if (block->used_objects_count == 0)
+    {
+        //     
+        remove_superblock(owner_heap, block);
+        owner_heap.statistics.allocated_size -= get_superblock_size();
+
+        block->~superblock();
+        deallocate_with_guard(block);
+    }
+}
+
+void *allocator_hoard::reallocate(
+    void *block_to_reallocate_address,
+    size_t new_block_size)
+{
+    auto const *block = *(reinterpret_cast<superblock **>(block_to_reallocate_address) - 1);
+
+    if (block != nullptr && get_size_class_index(new_block_size) == block->size_class_index)
+    {
+        return block_to_reallocate_address;
+    }
+
+    auto const block_size = block == nullptr
+        ? *(reinterpret_cast<size_t *>(block_to_reallocate_address) - 2)
+        : get_size_class_object_size(block->size_class_index);
+
+    auto * new_block = allocate(new_block_size);
+    memcpy(new_block, block_to_reallocate_address, std::min(block_size, new_block_size));
+    deallocate(block_to_reallocate_address);
+    return new_block;
+}
+
+bool allocator_hoard::reallocate(
+    void **block_to_reallocate_address_address,
+    size_t new_block_size)
+{
+    try {
+        *block_to_reallocate_address_address = reallocate(*block_to_reallocate_address_address, new_block_size);
+        return true;
+    }
+    catch (std::exception const &ex)
+    {
+        this->warning_with_guard(ex.what());
+        return false;
+    }
+}
+
+logger *allocator_hoard::get_logger() const noexcept
+{
+    return *reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1);
+}
+
+std::string allocator_hoard::get_typename() const noexcept
+{
+    return "allocator_hoard";
+}
+
+allocator *allocator_hoard::get_allocator() const noexcept
+{
+    return *reinterpret_cast<allocator **>(_trusted_memory);
+}
\ No newline at end of file
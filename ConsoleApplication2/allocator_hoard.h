@@ -0,0 +1,201 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_HOARD_H
+#define DATA_STRUCTURES_CPP_MEMORY_WITH_HOARD_H
+
+#include <mutex>
+#include "typename_holder.h"
+#include "logger.h"
+#include "logger_holder.h"
+#include "allocator.h"
+#include "allocator_holder.h"
+
+class allocator_hoard final:
+    public allocator,
+    protected logger_holder,
+    protected typename_holder,
+    protected allocator_holder
+{
+
+public:
+
+    // :         .
+    struct heap_statistics
+    {
+        //  ,     ( )
+        size_t in_use_size;
+
+        //    ( )
+        size_t allocated_size;
+
+        // ,   (   -     )
+        size_t superblocks_migrated_in_count;
+
+        // ,   (   -   )
+        size_t superblocks_migrated_out_count;
+    };
+
+private:
+
+    //     ( -  ).
+    static constexpr size_t _smallest_size_class = 16;
+
+    //   (16..1024 );       .
+    static constexpr size_t _size_classes_count = 7;
+
+    //  .
+    static constexpr size_t _minimal_superblock_size = 8192;
+
+    // ,            .
+    static constexpr size_t _slack_superblocks_count = 4;
+
+    //,       ,        .
+    static constexpr size_t _heap_alignment = 64;
+
+    //: ,        (  allocator_hoard.cpp).
+    struct heap;
+
+    //  (  allocator_hoard.cpp).
+    struct superblock;
+
+private:
+
+    void *_trusted_memory;
+
+public:
+
+    //      heaps_count  ,   outer_allocator   superblock_size.
+    //,     fullness_threshold_percent ,       ,
+    //        fullness_threshold_percent .
+    explicit allocator_hoard(
+        size_t heaps_count,
+        allocator *outer_allocator = nullptr,
+        logger *logger = nullptr,
+        size_t superblock_size = 16384,
+        size_t fullness_threshold_percent = 75);
+
+    allocator_hoard(
+        allocator_hoard const &other) = delete;
+
+    allocator_hoard &operator=(
+        allocator_hoard const &other) = delete;
+
+    // .         .
+    ~allocator_hoard() noexcept;
+
+private:
+
+    //        .
+    [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override;
+
+    //       (  ).
+    [[nodiscard]] size_t get_occupied_block_service_block_size() const noexcept override;
+
+    //  .
+    [[nodiscard]] size_t get_superblock_size() const noexcept;
+
+    //      ( ).
+    [[nodiscard]] size_t get_fullness_threshold_percent() const noexcept;
+
+    // ,       .
+    [[nodiscard]] static size_t get_heap_size() noexcept;
+
+    //    heap_index (0 -  ).
+    [[nodiscard]] heap &get_heap(
+        size_t heap_index) const noexcept;
+
+    //       requested_block_size (_size_classes_count,     ).
+    [[nodiscard]] static size_t get_size_class_index(
+        size_t requested_block_size) noexcept;
+
+    //     size_class_index.
+    [[nodiscard]] static size_t get_size_class_object_size(
+        size_t size_class_index) noexcept;
+
+    //    .
+    [[nodiscard]] static unsigned char *get_superblock_first_object_address(
+        superblock *block) noexcept;
+
+    //,        .
+    [[nodiscard]] bool is_superblock_sparse(
+        superblock const *block) const noexcept;
+
+    //    :   -  ,  -  .
+    static void insert_superblock(
+        heap &owner_heap,
+        superblock *block) noexcept;
+
+    //    .
+    static void remove_superblock(
+        heap &owner_heap,
+        superblock *block) noexcept;
+
+    //       size_class_index (     ).
+    [[nodiscard]] superblock *create_superblock(
+        size_t size_class_index);
+
+    //   heap_index (    )    size_class_index     .
+    [[nodiscard]] superblock *take_superblock_from_global_heap(
+        size_t heap_index,
+        size_t size_class_index);
+
+    //     heap_index (    )   ;     .
+    void migrate_superblock_to_global_heap(
+        size_t heap_index,
+        superblock *block);
+
+    //      heap_index      freed_into.
+    void restore_heap_emptiness_invariant(
+        size_t heap_index,
+        superblock *freed_into);
+
+public:
+
+    //    (    1..heaps_count,   -  0).
+    [[nodiscard]] size_t get_heaps_count() const noexcept;
+
+    //     heap_index.
+    [[nodiscard]] heap_statistics get_heap_statistics(
+        size_t heap_index) const;
+
+public:
+
+    //  ,    ,    .
+    [[nodiscard]] size_t get_natural_alignment() const noexcept override;
+
+    //         .
+    void *allocate(
+        size_t requested_block_size) override;
+
+    using allocator::deallocate;
+
+    //  ; ,   ,      .
+    void deallocate(
+        void *block_to_deallocate_address) override;
+
+    //  ,     new_block_size.        ,   .
+    [[nodiscard]] void *reallocate(
+        void *block_to_reallocate_address,
+        size_t new_block_size) override;
+
+    //      .    ,    .
+    bool reallocate(
+        void **block_to_reallocate_address_address,
+        size_t new_block_size) override;
+
+private:
+
+    //    logger,    .
+    [[nodiscard]] logger *get_logger() const noexcept override;
+
+private:
+
+    //     (allocator_hoard).
+    [[nodiscard]] std::string get_typename() const noexcept override;
+
+private:
+
+    //     (  ).
+    [[nodiscard]] allocator *get_allocator() const noexcept override;
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_WITH_HOARD_H
\ No newline at end of file
@@ -1,3 +1,4 @@
+#include <cstddef>
 #include "allocator_holder.h"
 
 void *allocator_holder::allocate_with_guard(
@@ -10,6 +11,15 @@ void *allocator_holder::allocate_with_guard(
         : allocator->allocate(block_size);
 }
 
+size_t allocator_holder::get_natural_alignment_with_guard() const noexcept
+{
+    auto *allocator = get_allocator();
+
+    return allocator == nullptr
+        ? alignof(std::max_align_t)
+        : allocator->get_natural_alignment();
+}
+
 void allocator_holder::deallocate_with_guard(
     void *block_pointer) const
 {
@@ -20,6 +20,8 @@ public:
 
 protected:
 
+    [[nodiscard]] size_t get_natural_alignment_with_guard() const noexcept;
+
     [[nodiscard]] virtual allocator *get_allocator() const noexcept = 0;
 
 };
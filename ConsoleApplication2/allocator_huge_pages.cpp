@@ -0,0 +1,312 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include "allocator_huge_pages.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fstream>
+#include <string>
+#include <sys/mman.h>
+#endif
+
+#ifndef _WIN32
+namespace
+{
+
+    //   AnonHugePages  /proc/self/smaps,  ,  mapping_address,        .
+    bool is_backed_by_transparent_huge_pages(
+        void const *mapping_address) noexcept
+    {
+        try
+        {
+            std::ifstream smaps("/proc/self/smaps");
+            std::string line;
+            auto const address = static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(mapping_address));
+            auto inside_mapping = false;
+
+            while (std::getline(smaps, line))
+            {
+                //    "-  ..."   
+                char *range_begin_end;
+                auto const range_begin = std::strtoull(line.c_str(), &range_begin_end, 16);
+                if (*range_begin_end == '-')
+                {
+                    inside_mapping = range_begin <= address && address < std::strtoull(range_begin_end + 1, nullptr, 16);
+                    continue;
+                }
+
+                if (inside_mapping && line.compare(0, 14, "AnonHugePages:") == 0)
+                {
+                    return std::strtoull(line.c_str() + 14, nullptr, 10) != 0;
+                }
+            }
+        }
+        catch (...)
+        {
+
+        }
+
+        return false;
+    }
+
+}
+#endif
+
+allocator_huge_pages::allocator_huge_pages(
+    logger *log)
+{
+    auto got_typename = get_typename();
+
+    if (log != nullptr)
+    {
+        log->trace(got_typename + " allocator instance construction started");
+    }
+
+    _trusted_memory = ::operator new(get_allocator_service_block_size());
+
+    auto * const logger_pointer_space = reinterpret_cast<logger **>(_trusted_memory);
+    *logger_pointer_space = log;
+
+    auto * const mapped_sizes_space = reinterpret_cast<size_t *>(logger_pointer_space + 1);
+    std::fill(mapped_sizes_space, mapped_sizes_space + 3, 0);
+
+    this->trace_with_guard(got_typename + " allocator instance construction finished");
+}
+
+allocator_huge_pages::~allocator_huge_pages() noexcept
+{
+    auto got_typename = get_typename();
+    this->trace_with_guard(got_typename + " allocator instance destruction started");
+
+    auto const * const logger = get_logger();
+
+    ::operator delete(_trusted_memory);
+
+    if (logger != nullptr)
+    {
+        logger->trace(got_typename + " allocator instance destruction finished");
+    }
+}
+
+size_t allocator_huge_pages::get_allocator_service_block_size() const noexcept
+{
+    auto const logger_pointer_size = sizeof(logger *);
+    auto const mapped_sizes_size = 3 * sizeof(size_t);
+
+    return logger_pointer_size + mapped_sizes_size;
+}
+
+size_t allocator_huge_pages::get_occupied_block_service_block_size() const noexcept
+{
+    return _mapping_service_block_size;
+}
+
+size_t allocator_huge_pages::get_occupied_block_size(
+    void const *current_block_address) const
+{
+    return *reinterpret_cast<size_t const *>(current_block_address);
+}
+
+size_t *allocator_huge_pages::get_mapped_size_address(
+    pages_kind pages) const noexcept
+{
+    return reinterpret_cast<size_t *>(reinterpret_cast<logger **>(_trusted_memory) + 1) + static_cast<size_t>(pages);
+}
+
+void *allocator_huge_pages::map_memory(
+    size_t mapping_size,
+    pages_kind &pages) noexcept
+{
+#ifdef _WIN32
+    //  Windows   SeLockMemoryPrivilege;   VirtualAlloc 
+    auto const large_page_size = GetLargePageMinimum();
+    if (large_page_size != 0 && mapping_size % large_page_size == 0)
+    {
+        auto *mapping = VirtualAlloc(nullptr, mapping_size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+        if (mapping != nullptr)
+        {
+            pages = pages_kind::huge_pages;
+            return mapping;
+        }
+    }
+
+    pages = pages_kind::regular_pages;
+    return VirtualAlloc(nullptr, mapping_size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+#ifdef MAP_HUGETLB
+    auto *mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (mapping != MAP_FAILED)
+    {
+        pages = pages_kind::huge_pages;
+        return mapping;
+    }
+#endif
+
+    // hugetlbfs   :   ,   2      
+    auto *unaligned_mapping = reinterpret_cast<unsigned char *>(mmap(nullptr, mapping_size + _huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (unaligned_mapping == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    auto * const aligned_mapping = reinterpret_cast<unsigned char *>((reinterpret_cast<size_t>(unaligned_mapping) + _huge_page_size - 1) & ~(_huge_page_size - 1));
+    if (aligned_mapping != unaligned_mapping)
+    {
+        munmap(unaligned_mapping, aligned_mapping - unaligned_mapping);
+    }
+    munmap(aligned_mapping + mapping_size, unaligned_mapping + _huge_page_size - aligned_mapping);
+
+    pages = pages_kind::regular_pages;
+#ifdef MADV_HUGEPAGE
+    // madvise    ( THP   never,   2    ),       ,      
+    if (madvise(aligned_mapping, mapping_size, MADV_HUGEPAGE) == 0)
+    {
+        *reinterpret_cast<size_t volatile *>(aligned_mapping) = mapping_size;
+
+        if (is_backed_by_transparent_huge_pages(aligned_mapping))
+        {
+            pages = pages_kind::transparent_huge_pages;
+        }
+    }
+#endif
+
+    return aligned_mapping;
+#endif
+}
+
+void allocator_huge_pages::unmap_memory(
+    void *mapping_address,
+    size_t mapping_size) noexcept
+{
+#ifdef _WIN32
+    VirtualFree(mapping_address, 0, MEM_RELEASE);
+#else
+    munmap(mapping_address, mapping_size);
+#endif
+}
+
+size_t allocator_huge_pages::get_natural_alignment() const noexcept
+{
+    return _mapping_service_block_size;
+}
+
+void *allocator_huge_pages::allocate(
+    size_t requested_block_size)
+{
+    auto const got_typename = get_typename();
+    this->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution started")
+        ->debug_with_guard("Requested " + std::to_string(requested_block_size) + " bytes of memory");
+
+    //          
+    if (requested_block_size > std::numeric_limits<size_t>::max() - _mapping_service_block_size - 2 * _huge_page_size)
+    {
+        auto const warning_message = "no memory available to allocate";
+
+        this->warning_with_guard(warning_message)
+            ->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution finished");
+
+        throw memory_exception(warning_message);
+    }
+
+    auto const mapping_size = (requested_block_size + _mapping_service_block_size + _huge_page_size - 1) & ~(_huge_page_size - 1);
+    pages_kind pages;
+    auto * const mapping = reinterpret_cast<unsigned char *>(map_memory(mapping_size, pages));
+
+    if (mapping == nullptr)
+    {
+        auto const warning_message = "no memory available to allocate";
+
+        this->warning_with_guard(warning_message)
+            ->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution finished");
+
+        throw memory_exception(warning_message);
+    }
+
+    *reinterpret_cast<size_t *>(mapping) = mapping_size;
+    *reinterpret_cast<pages_kind *>(reinterpret_cast<size_t *>(mapping) + 1) = pages;
+    *get_mapped_size_address(pages) += mapping_size;
+
+    auto * const allocated_block = mapping + _mapping_service_block_size;
+
+    this->information_with_guard("Mapped " + std::to_string(mapping_size) + " bytes at " + address_to_hex(mapping) + " backed by " + (pages == pages_kind::huge_pages
+            ? "huge pages"
+            : pages == pages_kind::transparent_huge_pages
+                ? "transparent huge pages"
+                : "regular pages"))
+        ->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution finished");
+
+    return allocated_block;
+}
+
+void allocator_huge_pages::deallocate(
+    void *block_to_deallocate_address)
+{
+    auto const got_typename = get_typename();
+    this->trace_with_guard(got_typename + "::deallocate(void *block_to_deallocate_address) execution started");
+
+    auto * const mapping = reinterpret_cast<unsigned char *>(block_to_deallocate_address) - _mapping_service_block_size;
+    auto const mapping_size = get_occupied_block_size(mapping);
+
+    *get_mapped_size_address(get_pages_kind(block_to_deallocate_address)) -= mapping_size;
+    unmap_memory(mapping, mapping_size);
+
+    this->trace_with_guard(got_typename + "::deallocate method execution finished");
+}
+
+void *allocator_huge_pages::reallocate(
+    void *block_to_reallocate_address,
+    size_t new_block_size)
+{
+    auto const block_capacity = get_occupied_block_size(reinterpret_cast<unsigned char *>(block_to_reallocate_address) - _mapping_service_block_size) - _mapping_service_block_size;
+
+    if (new_block_size <= block_capacity)
+    {
+        return block_to_reallocate_address;
+    }
+
+    auto * new_block = allocate(new_block_size);
+    memcpy(new_block, block_to_reallocate_address, block_capacity);
+    deallocate(block_to_reallocate_address);
+    return new_block;
+}
+
+bool allocator_huge_pages::reallocate(
+    void **block_to_reallocate_address_address,
+    size_t new_block_size)
+{
+    try {
+        *block_to_reallocate_address_address = reallocate(*block_to_reallocate_address_address, new_block_size);
+        return true;
+    }
+    catch (std::exception const &ex)
+    {
+        this->warning_with_guard(ex.what());
+        return false;
+    }
+}
+
+allocator_huge_pages::pages_kind allocator_huge_pages::get_pages_kind(
+    void const *block_address) const noexcept
+{
+    return *reinterpret_cast<pages_kind const *>(reinterpret_cast<size_t const *>(reinterpret_cast<unsigned char const *>(block_address) - _mapping_service_block_size) + 1);
+}
+
+size_t allocator_huge_pages::get_mapped_size(
+    pages_kind pages) const noexcept
+{
+    return *get_mapped_size_address(pages);
+}
+
+logger *allocator_huge_pages::get_logger() const noexcept
+{
+    return *reinterpret_cast<logger **>(_trusted_memory);
+}
+
+std::string allocator_huge_pages::get_typename() const noexcept
+{
+    return "allocator_huge_pages";
+}
\ No newline at end of file
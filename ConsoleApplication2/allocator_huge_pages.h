@@ -0,0 +1,126 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_HUGE_PAGES_H
+#define DATA_STRUCTURES_CPP_MEMORY_WITH_HUGE_PAGES_H
+
+#include "typename_holder.h"
+#include "logger.h"
+#include "logger_holder.h"
+#include "allocator.h"
+
+class allocator_huge_pages final:
+    public allocator,
+    protected logger_holder,
+    protected typename_holder
+{
+
+public:
+
+    // ,    .
+    enum class pages_kind
+    {
+        regular_pages,
+        transparent_huge_pages,
+        huge_pages
+    };
+
+private:
+
+    // ( )  .
+    static constexpr size_t _huge_page_size = 2 * 1024 * 1024;
+
+    //     (  ,   ).
+    static constexpr size_t _mapping_service_block_size = 64;
+
+private:
+
+    void *_trusted_memory;
+
+public:
+
+    // ,             .
+    //     outer_allocator     .
+    explicit allocator_huge_pages(
+        logger *logger = nullptr);
+
+    allocator_huge_pages(
+        allocator_huge_pages const &other) = delete;
+
+    allocator_huge_pages &operator=(
+        allocator_huge_pages const &other) = delete;
+
+    // .        
+    ~allocator_huge_pages() noexcept;
+
+private:
+
+    //     .
+    [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override;
+
+    //       .
+    [[nodiscard]] size_t get_occupied_block_service_block_size() const noexcept override;
+
+    //  ,    current_block_address (  ).
+    size_t get_occupied_block_size(
+        void const *current_block_address) const override;
+
+    //   mapping_size,     ; pages   ,    .
+    [[nodiscard]] static void *map_memory(
+        size_t mapping_size,
+        pages_kind &pages) noexcept;
+
+    //     ,    pages.
+    [[nodiscard]] size_t *get_mapped_size_address(
+        pages_kind pages) const noexcept;
+
+    //   mapping_address  mapping_size.
+    static void unmap_memory(
+        void *mapping_address,
+        size_t mapping_size) noexcept;
+
+public:
+
+    //  :            .
+    [[nodiscard]] size_t get_natural_alignment() const noexcept override;
+
+    //    requested_block_size   ,   2 .
+    void *allocate(
+        size_t requested_block_size) override;
+
+    using allocator::deallocate;
+
+    //     block_to_deallocate_address.
+    void deallocate(
+        void *block_to_deallocate_address) override;
+
+    //  ,     new_block_size.      ,   .
+    [[nodiscard]] void *reallocate(
+        void *block_to_reallocate_address,
+        size_t new_block_size) override;
+
+    //      .    ,    .
+    bool reallocate(
+        void **block_to_reallocate_address_address,
+        size_t new_block_size) override;
+
+public:
+
+    //  ,       block_address.
+    [[nodiscard]] pages_kind get_pages_kind(
+        void const *block_address) const noexcept;
+
+    //    ,    pages.
+    [[nodiscard]] size_t get_mapped_size(
+        pages_kind pages) const noexcept;
+
+private:
+
+    //    logger,    .
+    [[nodiscard]] logger *get_logger() const noexcept override;
+
+private:
+
+    //     (allocator_huge_pages).
+    [[nodiscard]] std::string get_typename() const noexcept override;
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_WITH_HUGE_PAGES_H
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "allocator_memory_resource.h"
+
+allocator_memory_resource::allocator_memory_resource(
+    allocator *allocator) noexcept
+    : _allocator(allocator)
+{
+
+}
+
+allocator *allocator_memory_resource::get_allocator() const noexcept
+{
+    return _allocator;
+}
+
+void *allocator_memory_resource::do_allocate(
+    size_t bytes,
+    size_t alignment)
+{
+    return _allocator->allocate_aligned(bytes, alignment);
+}
+
+void allocator_memory_resource::do_deallocate(
+    void *block_to_deallocate_address,
+    size_t bytes,
+    size_t)
+{
+    _allocator->deallocate(block_to_deallocate_address, bytes);
+}
+
+bool allocator_memory_resource::do_is_equal(
+    std::pmr::memory_resource const &other) const noexcept
+{
+    auto const *other_resource = dynamic_cast<allocator_memory_resource const *>(&other);
+
+    return other_resource != nullptr && other_resource->_allocator == _allocator;
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_RESOURCE_H
+#define DATA_STRUCTURES_CPP_MEMORY_RESOURCE_H
+
+#include <memory_resource>
+#include "allocator.h"
+
+class allocator_memory_resource final:
+    public std::pmr::memory_resource
+{
+
+private:
+
+    allocator *_allocator;
+
+public:
+
+    //     std::pmr  allocator (     ).
+    explicit allocator_memory_resource(
+        allocator *allocator) noexcept;
+
+    allocator_memory_resource(
+        allocator_memory_resource const &other) = delete;
+
+    allocator_memory_resource &operator=(
+        allocator_memory_resource const &other) = delete;
+
+public:
+
+    // ,     .
+    [[nodiscard]] allocator *get_allocator() const noexcept;
+
+private:
+
+    //   bytes,   alignment,  allocate_aligned  
+    //(,     ,   allocate).
+    void *do_allocate(
+        size_t bytes,
+        size_t alignment) override;
+
+    //     deallocate(void *, size_t),   bytes;   .
+    void do_deallocate(
+        void *block_to_deallocate_address,
+        size_t bytes,
+        size_t alignment) override;
+
+    // ,         .
+    [[nodiscard]] bool do_is_equal(
+        std::pmr::memory_resource const &other) const noexcept override;
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_RESOURCE_H
\ No newline at end of file
@@ -0,0 +1,264 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include "allocator_pool.h"
+
+allocator_pool::allocator_pool(
+    size_t block_size,
+    size_t blocks_count,
+    allocator *outer_allocator,
+    logger *log)
+{
+    auto got_typename = get_typename();
+
+    if (log != nullptr)
+    {
+        log->trace(got_typename + " allocator instance construction started")
+            ->debug("requested " + std::to_string(blocks_count) + " blocks of " + std::to_string(block_size) + " bytes");
+    }
+
+    if (blocks_count == 0 || blocks_count >= _empty_stack_index)
+    {
+        auto error_message = "blocks count should be GT 0 and LT " + std::to_string(_empty_stack_index);
+
+        if (log != nullptr)
+        {
+            log->error(error_message);
+        }
+
+        throw allocator::memory_exception(error_message);
+    }
+
+    auto const allocator_service_block_size = get_allocator_service_block_size();
+
+    if (block_size > std::numeric_limits<size_t>::max() - (sizeof(size_t) - 1) ||
+        ((std::max(block_size, sizeof(size_t)) + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1)) > (std::numeric_limits<size_t>::max() - allocator_service_block_size) / blocks_count)
+    {
+        auto error_message = "pool of " + std::to_string(blocks_count) + " blocks of " + std::to_string(block_size) + " bytes does not fit into addressable memory";
+
+        if (log != nullptr)
+        {
+            log->error(error_message);
+        }
+
+        throw allocator::memory_exception(error_message);
+    }
+
+    //       
+    block_size = (std::max(block_size, sizeof(size_t)) + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1);
+
+    auto const memory_size = block_size * blocks_count;
+
+    _trusted_memory = outer_allocator == nullptr
+        ? ::operator new(memory_size + allocator_service_block_size)
+        : outer_allocator->allocate(memory_size + allocator_service_block_size);
+
+    auto * const memory_size_space = reinterpret_cast<size_t *>(_trusted_memory);
+    *memory_size_space = memory_size;
+
+    auto * const outer_allocator_pointer_space = reinterpret_cast<allocator **>(memory_size_space + 1);
+    *outer_allocator_pointer_space = outer_allocator;
+
+    auto * const logger_pointer_space = reinterpret_cast<logger **>(outer_allocator_pointer_space + 1);
+    *logger_pointer_space = log;
+
+    auto * const block_size_space = reinterpret_cast<size_t *>(logger_pointer_space + 1);
+    *block_size_space = block_size;
+
+    new (&get_available_blocks_stack_top()) std::atomic<unsigned long long>(0);
+
+    for (unsigned int block_index = 0; block_index < blocks_count; block_index++)
+    {
+        new (get_available_block_next_block_index_address(block_index)) std::atomic<unsigned int>(block_index + 1 == blocks_count
+            ? _empty_stack_index
+            : block_index + 1);
+    }
+
+    this->trace_with_guard(got_typename + " allocator instance construction finished");
+}
+
+allocator_pool::~allocator_pool() noexcept
+{
+    auto got_typename = get_typename();
+    this->trace_with_guard(got_typename + " allocator instance destruction started");
+
+    auto const * const logger = get_logger();
+
+    deallocate_with_guard(_trusted_memory);
+
+    if (logger != nullptr)
+    {
+        logger->trace(got_typename + " allocator instance destruction finished");
+    }
+}
+
+size_t allocator_pool::get_trusted_memory_size() const noexcept
+{
+    return *reinterpret_cast<size_t *>(_trusted_memory);
+}
+
+size_t allocator_pool::get_allocator_service_block_size() const noexcept
+{
+    auto const memory_size_size = sizeof(size_t);
+    auto const outer_allocator_pointer_size = sizeof(allocator *);
+    auto const logger_pointer_size = sizeof(logger *);
+    auto const block_size_size = sizeof(size_t);
+    auto const available_blocks_stack_top_alignment_size = alignof(std::atomic<unsigned long long>) - 1;
+    auto const available_blocks_stack_top_size = sizeof(std::atomic<unsigned long long>);
+
+    return memory_size_size + outer_allocator_pointer_size + logger_pointer_size + block_size_size + available_blocks_stack_top_alignment_size + available_blocks_stack_top_size;
+}
+
+size_t allocator_pool::get_occupied_block_service_block_size() const noexcept
+{
+    return 0;
+}
+
+size_t allocator_pool::get_block_size() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1) + 1) + 1);
+}
+
+std::atomic<unsigned long long> &allocator_pool::get_available_blocks_stack_top() const noexcept
+{
+    //     ,       
+    auto const available_blocks_stack_top_address = reinterpret_cast<uintptr_t>(_trusted_memory) + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *) + sizeof(size_t);
+
+    return *reinterpret_cast<std::atomic<unsigned long long> *>((available_blocks_stack_top_address + alignof(std::atomic<unsigned long long>) - 1) & ~(alignof(std::atomic<unsigned long long>) - 1));
+}
+
+unsigned char *allocator_pool::get_first_block_address() const noexcept
+{
+    //         sizeof(size_t),      
+    return reinterpret_cast<unsigned char *>(&get_available_blocks_stack_top() + 1);
+}
+
+std::atomic<unsigned int> *allocator_pool::get_available_block_next_block_index_address(
+    unsigned int block_index) const noexcept
+{
+    return reinterpret_cast<std::atomic<unsigned int> *>(get_first_block_address() + block_index * get_block_size());
+}
+
+void *allocator_pool::allocate(
+    size_t requested_block_size)
+{
+    if (requested_block_size > get_block_size())
+    {
+        auto const warning_message = "requested " + std::to_string(requested_block_size) + " bytes, but pool block size is " + std::to_string(get_block_size()) + " bytes";
+
+        this->warning_with_guard(warning_message);
+
+        throw memory_exception(warning_message);
+    }
+
+    auto &stack_top = get_available_blocks_stack_top();
+    auto current_top = stack_top.load(std::memory_order_acquire);
+    unsigned long long new_top;
+
+    //        ,  CAS   ,      (ABA)
+    do
+    {
+        auto const top_block_index = static_cast<unsigned int>(current_top);
+
+        if (top_block_index == _empty_stack_index)
+        {
+            auto const warning_message = "no memory available to allocate";
+
+            this->warning_with_guard(warning_message);
+
+            throw memory_exception(warning_message);
+        }
+
+        //     ,     ,   CAS  
+        auto const next_block_index = get_available_block_next_block_index_address(top_block_index)->load(std::memory_order_relaxed);
+        new_top = ((current_top >> 32) + 1) << 32 | next_block_index;
+    }
+    while (!stack_top.compare_exchange_weak(current_top, new_top, std::memory_order_acquire, std::memory_order_acquire));
+
+    return get_first_block_address() + static_cast<unsigned int>(current_top) * get_block_size();
+}
+
+void allocator_pool::deallocate(
+    void *block_to_deallocate_address)
+{
+    auto const block_index = static_cast<unsigned int>((reinterpret_cast<unsigned char *>(block_to_deallocate_address) - get_first_block_address()) / get_block_size());
+    //    ;      ,        allocate
+    auto *next_block_index_address = get_available_block_next_block_index_address(block_index);
+
+    auto &stack_top = get_available_blocks_stack_top();
+    auto current_top = stack_top.load(std::memory_order_relaxed);
+    unsigned long long new_top;
+
+    do
+    {
+        next_block_index_address->store(static_cast<unsigned int>(current_top), std::memory_order_relaxed);
+        new_top = ((current_top >> 32) + 1) << 32 | block_index;
+    }
+    while (!stack_top.compare_exchange_weak(current_top, new_top, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void allocator_pool::deallocate(
+    void *block_to_deallocate_address,
+    [[maybe_unused]] size_t block_size)
+{
+#ifdef _DEBUG
+    if (block_size > get_block_size())
+    {
+        auto const error_message = "deallocated block size " + std::to_string(block_size) + " bytes is GT pool block size " + std::to_string(get_block_size()) + " bytes";
+
+        this->error_with_guard(error_message);
+
+        throw std::invalid_argument(error_message);
+    }
+#endif
+
+    deallocate(block_to_deallocate_address);
+}
+
+void *allocator_pool::reallocate(
+    void *block_to_reallocate_address,
+    size_t new_block_size)
+{
+    if (new_block_size > get_block_size())
+    {
+        auto const warning_message = "requested " + std::to_string(new_block_size) + " bytes, but pool block size is " + std::to_string(get_block_size()) + " bytes";
+
+        this->warning_with_guard(warning_message);
+
+        throw memory_exception(warning_message);
+    }
+
+    return block_to_reallocate_address;
+}
+
+bool allocator_pool::reallocate(
+    void **block_to_reallocate_address_address,
+    size_t new_block_size)
+{
+    try {
+        *block_to_reallocate_address_address = reallocate(*block_to_reallocate_address_address, new_block_size);
+        return true;
+    }
+    catch (std::exception const &ex)
+    {
+        this->warning_with_guard(ex.what());
+        return false;
+    }
+}
+
+logger *allocator_pool::get_logger() const noexcept
+{
+    return *reinterpret_cast<logger **>(reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1) + 1);
+}
+
+std::string allocator_pool::get_typename() const noexcept
+{
+    return "allocator_pool";
+}
+
+allocator *allocator_pool::get_allocator() const noexcept
+{
+    return *reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1);
+}
\ No newline at end of file
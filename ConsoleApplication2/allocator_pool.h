@@ -0,0 +1,111 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_POOL_H
+#define DATA_STRUCTURES_CPP_MEMORY_WITH_POOL_H
+
+#include <atomic>
+#include "typename_holder.h"
+#include "logger.h"
+#include "logger_holder.h"
+#include "allocator.h"
+#include "allocator_holder.h"
+
+class allocator_pool final:
+    public allocator,
+    protected logger_holder,
+    protected typename_holder,
+    protected allocator_holder
+{
+
+private:
+
+    //,     .
+    static constexpr unsigned int _empty_stack_index = ~0u;
+
+private:
+
+    void *_trusted_memory;
+
+public:
+
+    //   blocks_count   block_size ( )        .
+    explicit allocator_pool(
+        size_t block_size,
+        size_t blocks_count,
+        allocator *outer_allocator = nullptr,
+        logger *logger = nullptr);
+
+    allocator_pool(
+        allocator_pool const &other) = delete;
+
+    allocator_pool &operator=(
+        allocator_pool const &other) = delete;
+
+    // .        
+    ~allocator_pool() noexcept;
+
+private:
+
+    //       
+    [[nodiscard]] size_t get_trusted_memory_size() const noexcept override;
+
+    //     .
+    [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override;
+
+    //        (    ).
+    [[nodiscard]] size_t get_occupied_block_service_block_size() const noexcept override;
+
+    //   .
+    [[nodiscard]] size_t get_block_size() const noexcept;
+
+    //    :     32      .
+    [[nodiscard]] std::atomic<unsigned long long> &get_available_blocks_stack_top() const noexcept;
+
+    //    .
+    [[nodiscard]] unsigned char *get_first_block_address() const noexcept;
+
+    //     ,       block_index.
+    [[nodiscard]] std::atomic<unsigned int> *get_available_block_next_block_index_address(
+        unsigned int block_index) const noexcept;
+
+public:
+
+    //  ;      .
+    void *allocate(
+        size_t requested_block_size) override;
+
+    //    block_to_deallocate_address    .
+    void deallocate(
+        void *block_to_deallocate_address) override;
+
+    //   block_size    ;    ,  block_size     .
+    void deallocate(
+        void *block_to_deallocate_address,
+        size_t block_size) override;
+
+    //   ,  new_block_size     ,   .
+    [[nodiscard]] void *reallocate(
+        void *block_to_reallocate_address,
+        size_t new_block_size) override;
+
+    //      .    ,    .
+    bool reallocate(
+        void **block_to_reallocate_address_address,
+        size_t new_block_size) override;
+
+private:
+
+    //    logger,    .
+    [[nodiscard]] logger *get_logger() const noexcept override;
+
+private:
+
+    //     (allocator_pool).
+    [[nodiscard]] std::string get_typename() const noexcept override;
+
+private:
+
+    //     (  ).
+    [[nodiscard]] allocator *get_allocator() const noexcept override;
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_WITH_POOL_H
\ No newline at end of file
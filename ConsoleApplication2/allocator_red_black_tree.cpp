@@ -0,0 +1,741 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include "allocator_red_black_tree.h"
+
+allocator_red_black_tree::allocator_red_black_tree(
+    size_t memory_size,
+    allocator *outer_allocator,
+    logger *log,
+    allocator_fit_allocation::allocation_mode allocation_mode)
+{
+    auto got_typename = get_typename();
+
+    if (log != nullptr)
+    {
+        log->trace(got_typename + " allocator instance construction started")
+            ->debug("requested memory size: " + std::to_string(memory_size) + " bytes");
+    }
+
+    auto const minimal_trusted_memory_size = get_available_block_service_block_size();
+
+    if (memory_size < minimal_trusted_memory_size)
+    {
+        auto error_message = "trusted memory size should be GT " + std::to_string(minimal_trusted_memory_size) + " bytes";
+
+        if (log != nullptr)
+        {
+            log->error(error_message);
+        }
+
+        throw allocator::memory_exception(error_message);
+    }
+
+    //   8 ,     
+    memory_size &= ~_block_flags_mask;
+
+    auto const allocator_service_block_size = get_allocator_service_block_size();
+
+    _trusted_memory = outer_allocator == nullptr
+        ? ::operator new(memory_size + allocator_service_block_size)
+        : outer_allocator->allocate(memory_size + allocator_service_block_size);
+
+    auto * const memory_size_space = reinterpret_cast<size_t *>(_trusted_memory);
+    *memory_size_space = memory_size;
+
+    auto * const outer_allocator_pointer_space = reinterpret_cast<allocator **>(memory_size_space + 1);
+    *outer_allocator_pointer_space = outer_allocator;
+
+    auto * const logger_pointer_space = reinterpret_cast<logger **>(outer_allocator_pointer_space + 1);
+    *logger_pointer_space = log;
+
+    auto * const allocation_mode_space = reinterpret_cast<allocator_fit_allocation::allocation_mode *>(logger_pointer_space + 1);
+    *allocation_mode_space = allocation_mode;
+
+    auto * const available_blocks_tree_root_space = reinterpret_cast<void **>(allocation_mode_space + 1);
+    *available_blocks_tree_root_space = nullptr;
+
+    //     ,     
+    write_available_block_tags(get_first_block_address(), memory_size, true);
+    insert_available_block(get_first_block_address());
+
+    this->trace_with_guard(got_typename + " allocator instance construction finished");
+}
+
+allocator_red_black_tree::~allocator_red_black_tree() noexcept
+{
+    auto got_typename = get_typename();
+    this->trace_with_guard(got_typename + " allocator instance destruction started");
+
+    auto const * const logger = get_logger();
+
+    deallocate_with_guard(_trusted_memory);
+
+    if (logger != nullptr)
+    {
+        logger->trace(got_typename + " allocator instance destruction finished");
+    }
+}
+
+size_t allocator_red_black_tree::get_trusted_memory_size() const noexcept
+{
+    return *reinterpret_cast<size_t *>(_trusted_memory);
+}
+
+allocator_fit_allocation::allocation_mode allocator_red_black_tree::get_allocation_mode() const noexcept
+{
+    return *reinterpret_cast<allocator_fit_allocation::allocation_mode *>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *));
+}
+
+size_t allocator_red_black_tree::get_allocator_service_block_size() const noexcept
+{
+    auto const memory_size_size = sizeof(size_t);
+    auto const outer_allocator_pointer_size = sizeof(allocator *);
+    auto const logger_pointer_size = sizeof(logger *);
+    auto const allocation_mode_size = sizeof(allocator_fit_allocation::allocation_mode);
+    auto const available_blocks_tree_root_pointer_size = sizeof(void *);
+    auto const first_block_alignment_size = alignof(size_t) - 1;
+
+    return memory_size_size + outer_allocator_pointer_size + logger_pointer_size + allocation_mode_size + available_blocks_tree_root_pointer_size + first_block_alignment_size;
+}
+
+size_t allocator_red_black_tree::get_available_block_service_block_size() const noexcept
+{
+    auto const current_block_size_and_flags = sizeof(size_t);
+    auto const parent_pointer_size = sizeof(void *);
+    auto const left_child_pointer_size = sizeof(void *);
+    auto const right_child_pointer_size = sizeof(void *);
+    auto const boundary_tag_size = sizeof(size_t);
+
+    return current_block_size_and_flags + parent_pointer_size + left_child_pointer_size + right_child_pointer_size + boundary_tag_size;
+}
+
+size_t allocator_red_black_tree::get_occupied_block_service_block_size() const noexcept
+{
+    auto const current_block_size_and_flags = sizeof(size_t);
+
+    return current_block_size_and_flags;
+}
+
+bool allocator_red_black_tree::get_block_occupancy(
+    void const *block_pointer) const
+{
+    return (*reinterpret_cast<size_t const *>(block_pointer) & _block_occupied_flag) != 0;
+}
+
+void **allocator_red_black_tree::get_available_blocks_tree_root_address_address() const noexcept
+{
+    return reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *) + sizeof(allocator_fit_allocation::allocation_mode));
+}
+
+unsigned char *allocator_red_black_tree::get_first_block_address() const noexcept
+{
+    //        ,     8 
+    auto const first_block_address = reinterpret_cast<uintptr_t>(get_available_blocks_tree_root_address_address() + 1);
+
+    return reinterpret_cast<unsigned char *>((first_block_address + alignof(size_t) - 1) & ~(alignof(size_t) - 1));
+}
+
+size_t allocator_red_black_tree::get_available_block_size(
+    void const *current_block_address) const
+{
+    return *reinterpret_cast<size_t const *>(current_block_address) & ~_block_flags_mask;
+}
+
+size_t allocator_red_black_tree::get_occupied_block_size(
+    void const *current_block_address) const
+{
+    return *reinterpret_cast<size_t const *>(current_block_address) & ~_block_flags_mask;
+}
+
+void *allocator_red_black_tree::get_occupied_block_previous_block_address(
+    void const *current_block_address) const
+{
+    if ((*reinterpret_cast<size_t const *>(current_block_address) & _previous_block_occupied_flag) != 0)
+    {
+        return nullptr;
+    }
+
+    auto const previous_block_size = *(reinterpret_cast<size_t const *>(current_block_address) - 1);
+
+    return const_cast<unsigned char *>(reinterpret_cast<unsigned char const *>(current_block_address) - previous_block_size);
+}
+
+void *allocator_red_black_tree::get_occupied_block_next_block_address(
+    void const *current_block_address) const
+{
+    auto * const next_block = const_cast<unsigned char *>(reinterpret_cast<unsigned char const *>(current_block_address) + get_occupied_block_size(current_block_address));
+
+    return static_cast<size_t>(next_block - get_first_block_address()) < get_trusted_memory_size()
+        ? next_block
+        : nullptr;
+}
+
+void **allocator_red_black_tree::get_available_block_parent_address_address(
+    void *current_block_address) noexcept
+{
+    return reinterpret_cast<void **>(reinterpret_cast<size_t *>(current_block_address) + 1);
+}
+
+void **allocator_red_black_tree::get_available_block_left_child_address_address(
+    void *current_block_address) noexcept
+{
+    return get_available_block_parent_address_address(current_block_address) + 1;
+}
+
+void **allocator_red_black_tree::get_available_block_right_child_address_address(
+    void *current_block_address) noexcept
+{
+    return get_available_block_parent_address_address(current_block_address) + 2;
+}
+
+bool allocator_red_black_tree::is_available_block_red(
+    void const *current_block_address) noexcept
+{
+    return current_block_address != nullptr && (*reinterpret_cast<size_t const *>(current_block_address) & _available_block_red_flag) != 0;
+}
+
+void allocator_red_black_tree::set_available_block_red(
+    void *current_block_address,
+    bool red) noexcept
+{
+    auto * const current_block_size_and_flags = reinterpret_cast<size_t *>(current_block_address);
+
+    *current_block_size_and_flags = red
+        ? *current_block_size_and_flags | _available_block_red_flag
+        : *current_block_size_and_flags & ~_available_block_red_flag;
+}
+
+bool allocator_red_black_tree::is_available_block_less(
+    void const *left,
+    void const *right) const noexcept
+{
+    auto const left_size = get_available_block_size(left);
+    auto const right_size = get_available_block_size(right);
+
+    return left_size < right_size || (left_size == right_size && left < right);
+}
+
+void allocator_red_black_tree::write_available_block_tags(
+    void *block_address,
+    size_t block_size,
+    bool previous_block_occupied) const noexcept
+{
+    *reinterpret_cast<size_t *>(block_address) = previous_block_occupied
+        ? block_size | _previous_block_occupied_flag
+        : block_size;
+
+    *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(block_address) + block_size - sizeof(size_t)) = block_size;
+}
+
+void allocator_red_black_tree::rotate_available_blocks_tree_left(
+    void *block_address)
+{
+    auto * const pivot = *get_available_block_right_child_address_address(block_address);
+    auto * const pivot_left_child = *get_available_block_left_child_address_address(pivot);
+
+    *get_available_block_right_child_address_address(block_address) = pivot_left_child;
+    if (pivot_left_child != nullptr)
+    {
+        *get_available_block_parent_address_address(pivot_left_child) = block_address;
+    }
+
+    transplant_available_block(block_address, pivot);
+
+    *get_available_block_left_child_address_address(pivot) = block_address;
+    *get_available_block_parent_address_address(block_address) = pivot;
+}
+
+void allocator_red_black_tree::rotate_available_blocks_tree_right(
+    void *block_address)
+{
+    auto * const pivot = *get_available_block_left_child_address_address(block_address);
+    auto * const pivot_right_child = *get_available_block_right_child_address_address(pivot);
+
+    *get_available_block_left_child_address_address(block_address) = pivot_right_child;
+    if (pivot_right_child != nullptr)
+    {
+        *get_available_block_parent_address_address(pivot_right_child) = block_address;
+    }
+
+    transplant_available_block(block_address, pivot);
+
+    *get_available_block_right_child_address_address(pivot) = block_address;
+    *get_available_block_parent_address_address(block_address) = pivot;
+}
+
+void allocator_red_black_tree::transplant_available_block(
+    void *replaced,
+    void *replacement)
+{
+    auto * const parent = *get_available_block_parent_address_address(replaced);
+
+    if (parent == nullptr)
+    {
+        *get_available_blocks_tree_root_address_address() = replacement;
+    }
+    else if (*get_available_block_left_child_address_address(parent) == replaced)
+    {
+        *get_available_block_left_child_address_address(parent) = replacement;
+    }
+    else
+    {
+        *get_available_block_right_child_address_address(parent) = replacement;
+    }
+
+    if (replacement != nullptr)
+    {
+        *get_available_block_parent_address_address(replacement) = parent;
+    }
+}
+
+void allocator_red_black_tree::insert_available_block(
+    void *block_address)
+{
+    void *parent = nullptr;
+    auto *current = *get_available_blocks_tree_root_address_address();
+
+    while (current != nullptr)
+    {
+        parent = current;
+        current = is_available_block_less(block_address, current)
+            ? *get_available_block_left_child_address_address(current)
+            : *get_available_block_right_child_address_address(current);
+    }
+
+    *get_available_block_parent_address_address(block_address) = parent;
+    *get_available_block_left_child_address_address(block_address) = nullptr;
+    *get_available_block_right_child_address_address(block_address) = nullptr;
+    set_available_block_red(block_address, true);
+
+    if (parent == nullptr)
+    {
+        *get_available_blocks_tree_root_address_address() = block_address;
+    }
+    else if (is_available_block_less(block_address, parent))
+    {
+        *get_available_block_left_child_address_address(parent) = block_address;
+    }
+    else
+    {
+        *get_available_block_right_child_address_address(parent) = block_address;
+    }
+
+    current = block_address;
+    while (is_available_block_red(parent = *get_available_block_parent_address_address(current)))
+    {
+        //     ,   
+        auto * const grandparent = *get_available_block_parent_address_address(parent);
+        auto const parent_is_left_child = *get_available_block_left_child_address_address(grandparent) == parent;
+        auto * const uncle = parent_is_left_child
+            ? *get_available_block_right_child_address_address(grandparent)
+            : *get_available_block_left_child_address_address(grandparent);
+
+        if (is_available_block_red(uncle))
+        {
+            set_available_block_red(parent, false);
+            set_available_block_red(uncle, false);
+            set_available_block_red(grandparent, true);
+            current = grandparent;
+            continue;
+        }
+
+        if (parent_is_left_child)
+        {
+            if (*get_available_block_right_child_address_address(parent) == current)
+            {
+                current = parent;
+                rotate_available_blocks_tree_left(current);
+                parent = *get_available_block_parent_address_address(current);
+            }
+
+            set_available_block_red(parent, false);
+            set_available_block_red(grandparent, true);
+            rotate_available_blocks_tree_right(grandparent);
+        }
+        else
+        {
+            if (*get_available_block_left_child_address_address(parent) == current)
+            {
+                current = parent;
+                rotate_available_blocks_tree_right(current);
+                parent = *get_available_block_parent_address_address(current);
+            }
+
+            set_available_block_red(parent, false);
+            set_available_block_red(grandparent, true);
+            rotate_available_blocks_tree_left(grandparent);
+        }
+    }
+
+    set_available_block_red(*get_available_blocks_tree_root_address_address(), false);
+}
+
+void allocator_red_black_tree::remove_available_block(
+    void *block_address)
+{
+    auto * const left_child = *get_available_block_left_child_address_address(block_address);
+    auto * const right_child = *get_available_block_right_child_address_address(block_address);
+    auto removed_red = is_available_block_red(block_address);
+    void *replacement, *replacement_parent;
+
+    if (left_child == nullptr || right_child == nullptr)
+    {
+        replacement = left_child == nullptr
+            ? right_child
+            : left_child;
+        replacement_parent = *get_available_block_parent_address_address(block_address);
+        transplant_available_block(block_address, replacement);
+    }
+    else
+    {
+        auto *successor = right_child;
+        while (*get_available_block_left_child_address_address(successor) != nullptr)
+        {
+            successor = *get_available_block_left_child_address_address(successor);
+        }
+
+        removed_red = is_available_block_red(successor);
+        replacement = *get_available_block_right_child_address_address(successor);
+
+        if (successor == right_child)
+        {
+            replacement_parent = successor;
+        }
+        else
+        {
+            replacement_parent = *get_available_block_parent_address_address(successor);
+            transplant_available_block(successor, replacement);
+            *get_available_block_right_child_address_address(successor) = right_child;
+            *get_available_block_parent_address_address(right_child) = successor;
+        }
+
+        transplant_available_block(block_address, successor);
+        *get_available_block_left_child_address_address(successor) = left_child;
+        *get_available_block_parent_address_address(left_child) = successor;
+        set_available_block_red(successor, is_available_block_red(block_address));
+    }
+
+    if (!removed_red)
+    {
+        fix_available_blocks_tree_after_remove(replacement, replacement_parent);
+    }
+}
+
+void allocator_red_black_tree::fix_available_blocks_tree_after_remove(
+    void *block_address,
+    void *parent_block_address)
+{
+    while (block_address != *get_available_blocks_tree_root_address_address() && !is_available_block_red(block_address))
+    {
+        auto const is_left_child = *get_available_block_left_child_address_address(parent_block_address) == block_address;
+        auto *sibling = is_left_child
+            ? *get_available_block_right_child_address_address(parent_block_address)
+            : *get_available_block_left_child_address_address(parent_block_address);
+
+        if (is_available_block_red(sibling))
+        {
+            set_available_block_red(sibling, false);
+            set_available_block_red(parent_block_address, true);
+
+            if (is_left_child)
+            {
+                rotate_available_blocks_tree_left(parent_block_address);
+                sibling = *get_available_block_right_child_address_address(parent_block_address);
+            }
+            else
+            {
+                rotate_available_blocks_tree_right(parent_block_address);
+                sibling = *get_available_block_left_child_address_address(parent_block_address);
+            }
+        }
+
+        auto *near_nephew = is_left_child
+            ? *get_available_block_left_child_address_address(sibling)
+            : *get_available_block_right_child_address_address(sibling);
+        auto *far_nephew = is_left_child
+            ? *get_available_block_right_child_address_address(sibling)
+            : *get_available_block_left_child_address_address(sibling);
+
+        if (!is_available_block_red(near_nephew) && !is_available_block_red(far_nephew))
+        {
+            set_available_block_red(sibling, true);
+            block_address = parent_block_address;
+            parent_block_address = *get_available_block_parent_address_address(block_address);
+            continue;
+        }
+
+        if (!is_available_block_red(far_nephew))
+        {
+            set_available_block_red(near_nephew, false);
+            set_available_block_red(sibling, true);
+
+            if (is_left_child)
+            {
+                rotate_available_blocks_tree_right(sibling);
+                sibling = *get_available_block_right_child_address_address(parent_block_address);
+                far_nephew = *get_available_block_right_child_address_address(sibling);
+            }
+            else
+            {
+                rotate_available_blocks_tree_left(sibling);
+                sibling = *get_available_block_left_child_address_address(parent_block_address);
+                far_nephew = *get_available_block_left_child_address_address(sibling);
+            }
+        }
+
+        set_available_block_red(sibling, is_available_block_red(parent_block_address));
+        set_available_block_red(parent_block_address, false);
+        set_available_block_red(far_nephew, false);
+
+        is_left_child
+            ? rotate_available_blocks_tree_left(parent_block_address)
+            : rotate_available_blocks_tree_right(parent_block_address);
+
+        block_address = *get_available_blocks_tree_root_address_address();
+    }
+
+    if (block_address != nullptr)
+    {
+        set_available_block_red(block_address, false);
+    }
+}
+
+void *allocator_red_black_tree::find_best_fit_available_block(
+    size_t required_block_size) const
+{
+    void *target_block = nullptr;
+    auto *current_block = *get_available_blocks_tree_root_address_address();
+
+    while (current_block != nullptr)
+    {
+        if (get_available_block_size(current_block) >= required_block_size)
+        {
+            target_block = current_block;
+            current_block = *get_available_block_left_child_address_address(current_block);
+        }
+        else
+        {
+            current_block = *get_available_block_right_child_address_address(current_block);
+        }
+    }
+
+    return target_block;
+}
+
+void *allocator_red_black_tree::find_worst_fit_available_block() const
+{
+    auto *current_block = *get_available_blocks_tree_root_address_address();
+
+    while (current_block != nullptr && *get_available_block_right_child_address_address(current_block) != nullptr)
+    {
+        current_block = *get_available_block_right_child_address_address(current_block);
+    }
+
+    return current_block;
+}
+
+void allocator_red_black_tree::dump_trusted_memory_blocks_state() const
+{
+    if (get_logger() == nullptr)
+    {
+        return;
+    }
+
+    std::string to_dump("|");
+    auto const memory_size = get_trusted_memory_size();
+    unsigned char *first_block = get_first_block_address();
+    unsigned char *current_block = first_block;
+
+    while (static_cast<size_t>(current_block - first_block) < memory_size)
+    {
+        auto const current_block_size = get_occupied_block_size(current_block);
+
+        to_dump += get_block_occupancy(current_block)
+            ? "occ "
+            : "avl ";
+
+        to_dump += std::to_string(current_block_size) + "|";
+        current_block += current_block_size;
+    }
+
+    this->debug_with_guard("Memory state: " + to_dump);
+}
+
+void *allocator_red_black_tree::allocate(
+    size_t requested_block_size)
+{
+    auto const got_typename = get_typename();
+    this->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution started")
+        ->debug_with_guard("Requested " + std::to_string(requested_block_size) + " bytes of memory");
+
+    auto const occupied_block_service_block_size = get_occupied_block_service_block_size();
+    auto const available_block_service_block_size = get_available_block_service_block_size();
+
+    //       size_t
+    if (requested_block_size > std::numeric_limits<size_t>::max() - occupied_block_service_block_size - _block_flags_mask)
+    {
+        auto const warning_message = "no memory available to allocate";
+
+        this->warning_with_guard(warning_message)
+            ->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution finished");
+
+        throw memory_exception(warning_message);
+    }
+
+    auto required_block_size = (requested_block_size + occupied_block_service_block_size + _block_flags_mask) & ~_block_flags_mask;
+    if (required_block_size < available_block_service_block_size)
+    {
+        required_block_size = available_block_service_block_size;
+    }
+
+    //   ,       
+    auto * const target_block = get_allocation_mode() == allocator_fit_allocation::allocation_mode::the_worst_fit
+        ? find_worst_fit_available_block()
+        : find_best_fit_available_block(required_block_size);
+
+    if (target_block == nullptr || get_available_block_size(target_block) < required_block_size)
+    {
+        auto const warning_message = "no memory available to allocate";
+
+        this->warning_with_guard(warning_message)
+            ->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution finished");
+
+        throw memory_exception(warning_message);
+    }
+
+    remove_available_block(target_block);
+
+    auto const target_block_size = get_available_block_size(target_block);
+    auto const target_block_flags = *reinterpret_cast<size_t *>(target_block) & _previous_block_occupied_flag;
+
+    if (target_block_size - required_block_size < available_block_service_block_size)
+    {
+        required_block_size = target_block_size;
+
+        auto * const next_block = get_occupied_block_next_block_address(target_block);
+        if (next_block != nullptr)
+        {
+            *reinterpret_cast<size_t *>(next_block) |= _previous_block_occupied_flag;
+        }
+    }
+    else
+    {
+        auto * const leftover_block = reinterpret_cast<unsigned char *>(target_block) + required_block_size;
+        write_available_block_tags(leftover_block, target_block_size - required_block_size, true);
+        insert_available_block(leftover_block);
+    }
+
+    if (required_block_size - occupied_block_service_block_size != requested_block_size)
+    {
+        this->trace_with_guard("Requested " + std::to_string(requested_block_size) + " bytes, but reserved " + std::to_string(required_block_size - occupied_block_service_block_size) + " bytes in according to correct work of allocator");
+    }
+
+    auto * const target_block_size_address = reinterpret_cast<size_t *>(target_block);
+    *target_block_size_address = required_block_size | _block_occupied_flag | target_block_flags;
+
+    auto * const allocated_block = reinterpret_cast<void *>(target_block_size_address + 1);
+
+    this->trace_with_guard("Allocated block placed at " + address_to_hex(allocated_block))
+        ->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution finished");
+
+    this->debug_with_guard("After `allocate` for " + std::to_string(requested_block_size) + " bytes (addr == " +
+                               address_to_hex(target_block_size_address) + "):");
+    dump_trusted_memory_blocks_state();
+    return allocated_block;
+}
+
+void allocator_red_black_tree::deallocate(
+    void *block_to_deallocate_address)
+{
+    auto const got_typename = get_typename();
+    this->trace_with_guard(got_typename + "::deallocate(void *block_to_deallocate_address) execution started");
+
+    block_to_deallocate_address = reinterpret_cast<void *>(reinterpret_cast<size_t *>(block_to_deallocate_address) - 1);
+
+    dump_occupied_block_before_deallocate(block_to_deallocate_address, get_logger());
+
+    auto block_to_deallocate_size = get_occupied_block_size(block_to_deallocate_address);
+    auto previous_block_occupied = (*reinterpret_cast<size_t *>(block_to_deallocate_address) & _previous_block_occupied_flag) != 0;
+    auto * const previous_block = get_occupied_block_previous_block_address(block_to_deallocate_address);
+    auto * const next_block = get_occupied_block_next_block_address(block_to_deallocate_address);
+
+    if (next_block != nullptr && !get_block_occupancy(next_block))
+    {
+        this->trace_with_guard("Merging next available block with target block...");
+        remove_available_block(next_block);
+        block_to_deallocate_size += get_available_block_size(next_block);
+        this->trace_with_guard("Merging completed");
+    }
+
+    if (previous_block != nullptr)
+    {
+        this->trace_with_guard("Merging previous available block with target block...");
+        remove_available_block(previous_block);
+        block_to_deallocate_size += get_available_block_size(previous_block);
+        previous_block_occupied = (*reinterpret_cast<size_t *>(previous_block) & _previous_block_occupied_flag) != 0;
+        block_to_deallocate_address = previous_block;
+        this->trace_with_guard("Merging completed");
+    }
+
+    write_available_block_tags(block_to_deallocate_address, block_to_deallocate_size, previous_block_occupied);
+    insert_available_block(block_to_deallocate_address);
+
+    auto * const following_block = get_occupied_block_next_block_address(block_to_deallocate_address);
+    if (following_block != nullptr)
+    {
+        *reinterpret_cast<size_t *>(following_block) &= ~_previous_block_occupied_flag;
+    }
+
+    this->debug_with_guard("After `deallocate` (addr == " + address_to_hex(block_to_deallocate_address) + "):");
+    dump_trusted_memory_blocks_state();
+    this->trace_with_guard(got_typename + "::deallocate method execution finished");
+}
+
+void *allocator_red_black_tree::reallocate(
+    void *block_to_reallocate_address,
+    size_t new_block_size)
+{
+    auto * new_block = allocate(new_block_size);
+    auto occupied_block_service_block_size = get_occupied_block_service_block_size();
+    auto data_to_move_size = std::min(get_occupied_block_size(reinterpret_cast<unsigned char const *>(new_block) - occupied_block_service_block_size), get_occupied_block_size(reinterpret_cast<unsigned char const *>(block_to_reallocate_address) - occupied_block_service_block_size)) - occupied_block_service_block_size;
+    memcpy(new_block, block_to_reallocate_address, data_to_move_size);
+    deallocate(block_to_reallocate_address);
+    return new_block;
+}
+
+bool allocator_red_black_tree::reallocate(
+    void **block_to_reallocate_address_address,
+    size_t new_block_size)
+{
+    try {
+        *block_to_reallocate_address_address = reallocate(*block_to_reallocate_address_address, new_block_size);
+        return true;
+    }
+    catch (std::exception const &ex)
+    {
+        this->warning_with_guard(ex.what());
+        return false;
+    }
+}
+
+void allocator_red_black_tree::setup_allocation_mode(
+    allocator_fit_allocation::allocation_mode mode)
+{
+    *reinterpret_cast<allocator_fit_allocation::allocation_mode *>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *)) = mode;
+}
+
+logger *allocator_red_black_tree::get_logger() const noexcept
+{
+    return *reinterpret_cast<logger **>(reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1) + 1);
+}
+
+std::string allocator_red_black_tree::get_typename() const noexcept
+{
+    return "allocator_red_black_tree";
+}
+
+allocator *allocator_red_black_tree::get_allocator() const noexcept
+{
+    return *reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1);
+}
\ No newline at end of file
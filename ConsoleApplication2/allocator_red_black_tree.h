@@ -0,0 +1,210 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_RED_BLACK_TREE_H
+#define DATA_STRUCTURES_CPP_MEMORY_WITH_RED_BLACK_TREE_H
+
+#include "typename_holder.h"
+#include "logger.h"
+#include "logger_holder.h"
+#include "allocator.h"
+#include "allocator_fit_allocation.h"
+#include "allocator_holder.h"
+
+class allocator_red_black_tree final:
+    public allocator_fit_allocation,
+    protected logger_holder,
+    protected typename_holder,
+    protected allocator_holder
+{
+
+private:
+
+    //     .
+    static constexpr size_t _block_occupied_flag = 1;
+
+    //   ( )    .
+    static constexpr size_t _previous_block_occupied_flag = 2;
+
+    //        .
+    static constexpr size_t _available_block_red_flag = 4;
+
+    //    (   8 ).
+    static constexpr size_t _block_flags_mask = 7;
+
+private:
+
+    void *_trusted_memory;
+
+public:
+    //     ,    ,
+    //    ( ),    .
+    explicit allocator_red_black_tree(
+        size_t memory_size,
+        allocator *outer_allocator = nullptr,
+        logger *logger = nullptr,
+        allocator_fit_allocation::allocation_mode allocation_mode = allocator_fit_allocation::allocation_mode::first_fit);
+
+    allocator_red_black_tree(
+        allocator_red_black_tree const &other) = delete;
+
+    allocator_red_black_tree &operator=(
+        allocator_red_black_tree const &other) = delete;
+
+    // .        
+    ~allocator_red_black_tree() noexcept;
+
+private:
+
+    //     
+    [[nodiscard]] size_t get_trusted_memory_size() const noexcept override;
+
+    //  ,   
+    [[nodiscard]] allocator_fit_allocation::allocation_mode get_allocation_mode() const noexcept override;
+
+    //     .
+    [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override;
+
+    //        (,     ).
+    [[nodiscard]] size_t get_available_block_service_block_size() const noexcept override;
+
+    //       .
+    [[nodiscard]] size_t get_occupied_block_service_block_size() const noexcept override;
+
+    // true,     block_pointer .
+    [[nodiscard]] bool get_block_occupancy(
+        void const *block_pointer) const override;
+
+    //       .
+    [[nodiscard]] void **get_available_blocks_tree_root_address_address() const noexcept;
+
+    //    .
+    [[nodiscard]] unsigned char *get_first_block_address() const noexcept;
+
+    //      current_block_address.
+    size_t get_available_block_size(
+        void const *current_block_address) const override;
+
+    //      current_block_address.
+    size_t get_occupied_block_size(
+        void const *current_block_address) const override;
+
+    //   ( ) ,   ,  nullptr.
+    void *get_occupied_block_previous_block_address(
+        void const *current_block_address) const override;
+
+    //   ( ) ,   ,  nullptr.
+    void *get_occupied_block_next_block_address(
+        void const *current_block_address) const override;
+
+    //      ,    .
+    [[nodiscard]] static void **get_available_block_parent_address_address(
+        void *current_block_address) noexcept;
+
+    //       ,    .
+    [[nodiscard]] static void **get_available_block_left_child_address_address(
+        void *current_block_address) noexcept;
+
+    //       ,    .
+    [[nodiscard]] static void **get_available_block_right_child_address_address(
+        void *current_block_address) noexcept;
+
+    // true,     (   ).
+    [[nodiscard]] static bool is_available_block_red(
+        void const *current_block_address) noexcept;
+
+    //   ,    .
+    static void set_available_block_red(
+        void *current_block_address,
+        bool red) noexcept;
+
+    // true,   (, )  left    right.
+    [[nodiscard]] bool is_available_block_less(
+        void const *left,
+        void const *right) const noexcept;
+
+    //      .
+    void write_available_block_tags(
+        void *block_address,
+        size_t block_size,
+        bool previous_block_occupied) const noexcept;
+
+    //       block_address.
+    void rotate_available_blocks_tree_left(
+        void *block_address);
+
+    //       block_address.
+    void rotate_available_blocks_tree_right(
+        void *block_address);
+
+    //      replaced    replacement.
+    void transplant_available_block(
+        void *replaced,
+        void *replacement);
+
+    //      .
+    void insert_available_block(
+        void *block_address);
+
+    //      .
+    void remove_available_block(
+        void *block_address);
+
+    //      .
+    void fix_available_blocks_tree_after_remove(
+        void *block_address,
+        void *parent_block_address);
+
+    //       required_block_size (nullptr,   ).
+    [[nodiscard]] void *find_best_fit_available_block(
+        size_t required_block_size) const;
+
+    //    (nullptr,    ).
+    [[nodiscard]] void *find_worst_fit_available_block() const;
+
+    //      allocator_red_black_tree (   ).
+    void dump_trusted_memory_blocks_state() const override;
+
+public:
+
+    //     requested_block_size       .
+    void *allocate(
+        size_t requested_block_size) override;
+
+    using allocator::deallocate;
+
+    //      block_to_deallocate_address,      .
+    void deallocate(
+        void *block_to_deallocate_address) override;
+
+    //  ,     new_block_size.
+    [[nodiscard]] void *reallocate(
+        void *block_to_reallocate_address,
+        size_t new_block_size) override;
+
+    //      .    ,    .
+    bool reallocate(
+        void **block_to_reallocate_address_address,
+        size_t new_block_size) override;
+
+public:
+
+    //    
+    void setup_allocation_mode(
+        allocator_fit_allocation::allocation_mode mode) override;
+
+private:
+
+    //    logger,    .
+    [[nodiscard]] logger *get_logger() const noexcept override;
+
+private:
+
+    //     (allocator_red_black_tree).
+    [[nodiscard]] std::string get_typename() const noexcept override;
+
+private:
+
+    //     (  ).
+    [[nodiscard]] allocator *get_allocator() const noexcept override;
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_WITH_RED_BLACK_TREE_H
\ No newline at end of file
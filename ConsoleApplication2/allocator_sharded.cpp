@@ -0,0 +1,362 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include "allocator_sorted_list.h"
+#include "allocator_sharded.h"
+
+struct allocator_sharded::arena_slot
+{
+    //,       
+    std::mutex mutex;
+
+    // ,     
+    allocator_sorted_list *arena;
+
+    // lock-free  ,     (      )
+    std::atomic<size_t *> remote_frees_head { nullptr };
+
+    //      
+    std::atomic<size_t> remote_frees_count { 0 };
+};
+
+namespace
+{
+
+    // ,   ;       .
+    std::atomic<size_t> threads_with_arena_count(0);
+
+    // ,    (      allocator_sharded).
+    thread_local size_t current_thread_arena_index = threads_with_arena_count.fetch_add(1, std::memory_order_relaxed);
+
+}
+
+allocator_sharded::allocator_sharded(
+    size_t arenas_count,
+    size_t arena_memory_size,
+    allocator *outer_allocator,
+    logger *log,
+    allocator_fit_allocation::allocation_mode allocation_mode)
+{
+    auto got_typename = get_typename();
+
+    if (log != nullptr)
+    {
+        log->trace(got_typename + " allocator instance construction started")
+            ->debug("requested " + std::to_string(arenas_count) + " arenas of " + std::to_string(arena_memory_size) + " bytes");
+    }
+
+    if (arenas_count == 0)
+    {
+        auto error_message = "arenas count should be GT 0";
+
+        if (log != nullptr)
+        {
+            log->error(error_message);
+        }
+
+        throw std::invalid_argument(error_message);
+    }
+
+    //    ,         
+    auto const allocator_service_block_size = sizeof(allocator *) + sizeof(logger *) + sizeof(size_t) + _arena_slot_alignment - 1 + arenas_count * get_arena_slot_size();
+
+    _trusted_memory = outer_allocator == nullptr
+        ? ::operator new(allocator_service_block_size)
+        : outer_allocator->allocate(allocator_service_block_size);
+
+    auto * const outer_allocator_pointer_space = reinterpret_cast<allocator **>(_trusted_memory);
+    *outer_allocator_pointer_space = outer_allocator;
+
+    auto * const logger_pointer_space = reinterpret_cast<logger **>(outer_allocator_pointer_space + 1);
+    *logger_pointer_space = log;
+
+    auto * const arenas_count_space = reinterpret_cast<size_t *>(logger_pointer_space + 1);
+    *arenas_count_space = arenas_count;
+
+    //   :         
+    for (size_t arena_index = 0; arena_index < arenas_count; arena_index++)
+    {
+        auto &slot = *new (&get_arena_slot(arena_index)) arena_slot;
+
+        try
+        {
+            slot.arena = new (allocate_with_guard(sizeof(allocator_sorted_list))) allocator_sorted_list(arena_memory_size, outer_allocator, nullptr, allocation_mode);
+
+            //        ;          
+            slot.arena->setup_default_alignment(alignof(size_t));
+        }
+        catch (...)
+        {
+            slot.~arena_slot();
+            destroy_arenas(arena_index);
+            deallocate_with_guard(_trusted_memory);
+            throw;
+        }
+    }
+
+    this->trace_with_guard(got_typename + " allocator instance construction finished");
+}
+
+allocator_sharded::~allocator_sharded() noexcept
+{
+    auto got_typename = get_typename();
+    this->trace_with_guard(got_typename + " allocator instance destruction started");
+
+    auto const * const logger = get_logger();
+
+    destroy_arenas(get_arenas_count());
+    deallocate_with_guard(_trusted_memory);
+
+    if (logger != nullptr)
+    {
+        logger->trace(got_typename + " allocator instance destruction finished");
+    }
+}
+
+size_t allocator_sharded::get_allocator_service_block_size() const noexcept
+{
+    auto const outer_allocator_pointer_size = sizeof(allocator *);
+    auto const logger_pointer_size = sizeof(logger *);
+    auto const arenas_count_size = sizeof(size_t);
+    auto const arena_slots_alignment_size = _arena_slot_alignment - 1;
+    auto const arena_slots_size = get_arenas_count() * get_arena_slot_size();
+
+    return outer_allocator_pointer_size + logger_pointer_size + arenas_count_size + arena_slots_alignment_size + arena_slots_size;
+}
+
+size_t allocator_sharded::get_occupied_block_service_block_size() const noexcept
+{
+    auto const arena_index_size = sizeof(size_t);
+    auto const requested_block_size_size = sizeof(size_t);
+
+    return arena_index_size + requested_block_size_size;
+}
+
+size_t allocator_sharded::get_arena_slot_size() noexcept
+{
+    return (sizeof(arena_slot) + _arena_slot_alignment - 1) & ~(_arena_slot_alignment - 1);
+}
+
+size_t allocator_sharded::get_arenas_count() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1) + 1);
+}
+
+allocator_sharded::arena_slot &allocator_sharded::get_arena_slot(
+    size_t arena_index) const noexcept
+{
+    auto const arena_slots_address = reinterpret_cast<uintptr_t>(_trusted_memory) + sizeof(allocator *) + sizeof(logger *) + sizeof(size_t);
+    auto * const first_arena_slot = reinterpret_cast<unsigned char *>((arena_slots_address + _arena_slot_alignment - 1) & ~(_arena_slot_alignment - 1));
+
+    return *reinterpret_cast<arena_slot *>(first_arena_slot + arena_index * get_arena_slot_size());
+}
+
+void *allocator_sharded::allocate_from_arena(
+    size_t arena_index,
+    size_t requested_block_size) const
+{
+    size_t *block_address;
+
+    drain_remote_frees(arena_index);
+
+    try
+    {
+        block_address = reinterpret_cast<size_t *>(get_arena_slot(arena_index).arena->allocate(requested_block_size + get_occupied_block_service_block_size()));
+    }
+    catch (memory_exception const &)
+    {
+        return nullptr;
+    }
+
+    //       ,   
+    block_address[0] = arena_index;
+    block_address[1] = requested_block_size;
+
+    return block_address + 2;
+}
+
+void allocator_sharded::drain_remote_frees(
+    size_t arena_index) const
+{
+    auto &slot = get_arena_slot(arena_index);
+
+    if (slot.remote_frees_head.load(std::memory_order_relaxed) == nullptr)
+    {
+        return;
+    }
+
+    //   ,     ABA
+    auto *remote_block_address = slot.remote_frees_head.exchange(nullptr, std::memory_order_acquire);
+    void *blocks_to_deallocate[_remote_frees_drain_threshold];
+
+    while (remote_block_address != nullptr)
+    {
+        size_t blocks_count = 0;
+
+        while (remote_block_address != nullptr && blocks_count < _remote_frees_drain_threshold)
+        {
+            blocks_to_deallocate[blocks_count++] = remote_block_address;
+            remote_block_address = reinterpret_cast<size_t *>(remote_block_address[1]);
+        }
+
+        slot.arena->deallocate_batch(blocks_to_deallocate, blocks_count);
+        slot.remote_frees_count.fetch_sub(blocks_count, std::memory_order_relaxed);
+    }
+}
+
+void allocator_sharded::destroy_arenas(
+    size_t arenas_count) noexcept
+{
+    for (size_t arena_index = 0; arena_index < arenas_count; arena_index++)
+    {
+        auto &slot = get_arena_slot(arena_index);
+
+        slot.arena->~allocator_sorted_list();
+        deallocate_with_guard(slot.arena);
+        slot.~arena_slot();
+    }
+}
+
+void *allocator_sharded::allocate(
+    size_t requested_block_size)
+{
+    auto const arenas_count = get_arenas_count();
+    auto const preferred_arena_index = current_thread_arena_index % arenas_count;
+
+    if (requested_block_size <= std::numeric_limits<size_t>::max() - get_occupied_block_service_block_size())
+    {
+        //     ,      
+        for (auto const wait_for_arena : { false, true })
+        {
+            for (size_t attempt = 0; attempt < arenas_count; attempt++)
+            {
+                auto const arena_index = (preferred_arena_index + attempt) % arenas_count;
+                std::unique_lock<std::mutex> arena_lock(get_arena_slot(arena_index).mutex, std::defer_lock);
+
+                if (wait_for_arena)
+                {
+                    arena_lock.lock();
+                }
+                else if (!arena_lock.try_lock())
+                {
+                    continue;
+                }
+
+                auto * const allocated_block = allocate_from_arena(arena_index, requested_block_size);
+
+                if (allocated_block != nullptr)
+                {
+                    //   ,     
+                    current_thread_arena_index = arena_index;
+                    return allocated_block;
+                }
+            }
+        }
+    }
+
+    auto const warning_message = "no memory available to allocate";
+
+    this->warning_with_guard(warning_message);
+
+    throw memory_exception(warning_message);
+}
+
+void allocator_sharded::deallocate(
+    void *block_to_deallocate_address)
+{
+    auto * const block_address = reinterpret_cast<size_t *>(block_to_deallocate_address) - 2;
+    auto const arena_index = block_address[0];
+    auto &slot = get_arena_slot(arena_index);
+
+    if (arena_index == current_thread_arena_index % get_arenas_count())
+    {
+        std::lock_guard<std::mutex> arena_lock(slot.mutex);
+        slot.arena->deallocate(block_address);
+        return;
+    }
+
+    //          :         
+    auto *head = slot.remote_frees_head.load(std::memory_order_relaxed);
+
+    do
+    {
+        block_address[1] = reinterpret_cast<size_t>(head);
+    }
+    while (!slot.remote_frees_head.compare_exchange_weak(head, block_address, std::memory_order_release, std::memory_order_relaxed));
+
+    if (slot.remote_frees_count.fetch_add(1, std::memory_order_relaxed) + 1 >= _remote_frees_drain_threshold)
+    {
+        std::unique_lock<std::mutex> arena_lock(slot.mutex, std::try_to_lock);
+
+        if (arena_lock.owns_lock())
+        {
+            drain_remote_frees(arena_index);
+        }
+    }
+}
+
+void *allocator_sharded::reallocate(
+    void *block_to_reallocate_address,
+    size_t new_block_size)
+{
+    auto * const block_address = reinterpret_cast<size_t *>(block_to_reallocate_address) - 2;
+    auto const block_size = block_address[1];
+
+    if (new_block_size <= std::numeric_limits<size_t>::max() - get_occupied_block_service_block_size())
+    {
+        auto &slot = get_arena_slot(block_address[0]);
+        std::lock_guard<std::mutex> arena_lock(slot.mutex);
+
+        try
+        {
+            auto * const reallocated_block_address = reinterpret_cast<size_t *>(slot.arena->reallocate(block_address, new_block_size + get_occupied_block_service_block_size()));
+            reallocated_block_address[1] = new_block_size;
+
+            return reallocated_block_address + 2;
+        }
+        catch (memory_exception const &)
+        {
+
+        }
+    }
+
+    //  :     
+    auto * new_block = allocate(new_block_size);
+    memcpy(new_block, block_to_reallocate_address, std::min(block_size, new_block_size));
+    deallocate(block_to_reallocate_address);
+    return new_block;
+}
+
+bool allocator_sharded::reallocate(
+    void **block_to_reallocate_address_address,
+    size_t new_block_size)
+{
+    try {
+        *block_to_reallocate_address_address = reallocate(*block_to_reallocate_address_address, new_block_size);
+        return true;
+    }
+    catch (std::exception const &ex)
+    {
+        this->warning_with_guard(ex.what());
+        return false;
+    }
+}
+
+logger *allocator_sharded::get_logger() const noexcept
+{
+    return *reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1);
+}
+
+std::string allocator_sharded::get_typename() const noexcept
+{
+    return "allocator_sharded";
+}
+
+allocator *allocator_sharded::get_allocator() const noexcept
+{
+    return *reinterpret_cast<allocator **>(_trusted_memory);
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_SHARDED_ARENAS_H
+#define DATA_STRUCTURES_CPP_MEMORY_WITH_SHARDED_ARENAS_H
+
+#include <mutex>
+#include "typename_holder.h"
+#include "logger.h"
+#include "logger_holder.h"
+#include "allocator.h"
+#include "allocator_holder.h"
+#include "allocator_fit_allocation.h"
+
+class allocator_sharded final:
+    public allocator,
+    protected logger_holder,
+    protected typename_holder,
+    protected allocator_holder
+{
+
+private:
+
+    //,       ,        .
+    static constexpr size_t _arena_slot_alignment = 64;
+
+    //      ,         .
+    static constexpr size_t _remote_frees_drain_threshold = 64;
+
+    //:  allocator_sorted_list, ,       ,     (  allocator_sharded.cpp).
+    struct arena_slot;
+
+private:
+
+    void *_trusted_memory;
+
+public:
+
+    // arenas_count   allocator_sorted_list  arena_memory_size     allocation_mode.
+    //               .
+    explicit allocator_sharded(
+        size_t arenas_count,
+        size_t arena_memory_size,
+        allocator *outer_allocator = nullptr,
+        logger *logger = nullptr,
+        allocator_fit_allocation::allocation_mode allocation_mode = allocator_fit_allocation::allocation_mode::first_fit);
+
+    allocator_sharded(
+        allocator_sharded const &other) = delete;
+
+    allocator_sharded &operator=(
+        allocator_sharded const &other) = delete;
+
+    // .      .       .
+    ~allocator_sharded() noexcept;
+
+private:
+
+    //        .
+    [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override;
+
+    //       (     ).
+    [[nodiscard]] size_t get_occupied_block_service_block_size() const noexcept override;
+
+    // ,       .
+    [[nodiscard]] static size_t get_arena_slot_size() noexcept;
+
+    //  .
+    [[nodiscard]] size_t get_arenas_count() const noexcept;
+
+    //    arena_index.
+    [[nodiscard]] arena_slot &get_arena_slot(
+        size_t arena_index) const noexcept;
+
+    //   arena_index (    )   requested_block_size;     nullptr.
+    [[nodiscard]] void *allocate_from_arena(
+        size_t arena_index,
+        size_t requested_block_size) const;
+
+    //  arena_index (    )         .
+    void drain_remote_frees(
+        size_t arena_index) const;
+
+    //  arenas_count .
+    void destroy_arenas(
+        size_t arenas_count) noexcept;
+
+public:
+
+    //    requested_block_size     (       ).
+    [[nodiscard]] void *allocate(
+        size_t requested_block_size) override;
+
+    using allocator::deallocate;
+
+    //   ,     ;     .
+    //           .
+    void deallocate(
+        void *block_to_deallocate_address) override;
+
+    //     ,     -     .
+    [[nodiscard]] void *reallocate(
+        void *block_to_reallocate_address,
+        size_t new_block_size) override;
+
+    //      .    ,    .
+    bool reallocate(
+        void **block_to_reallocate_address_address,
+        size_t new_block_size) override;
+
+private:
+
+    //    logger,    .
+    [[nodiscard]] logger *get_logger() const noexcept override;
+
+private:
+
+    //     (allocator_sharded).
+    [[nodiscard]] std::string get_typename() const noexcept override;
+
+private:
+
+    //     (  ).
+    [[nodiscard]] allocator *get_allocator() const noexcept override;
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_WITH_SHARDED_ARENAS_H
\ No newline at end of file
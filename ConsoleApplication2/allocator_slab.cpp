@@ -0,0 +1,596 @@
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include "allocator_slab.h"
+
+allocator_slab::allocator_slab(
+    allocator *outer_allocator,
+    logger *log,
+    size_t span_size)
+{
+    auto got_typename = get_typename();
+
+    if (log != nullptr)
+    {
+        log->trace(got_typename + " allocator instance construction started")
+            ->debug("requested span size: " + std::to_string(span_size) + " bytes");
+    }
+
+    if (span_size < _minimal_span_size)
+    {
+        auto error_message = "span size should be GT " + std::to_string(_minimal_span_size) + " bytes";
+
+        if (log != nullptr)
+        {
+            log->error(error_message);
+        }
+
+        throw allocator::memory_exception(error_message);
+    }
+
+    auto const allocator_service_block_size = get_allocator_service_block_size();
+
+    _trusted_memory = outer_allocator == nullptr
+        ? ::operator new(allocator_service_block_size)
+        : outer_allocator->allocate(allocator_service_block_size);
+
+    auto * const outer_allocator_pointer_space = reinterpret_cast<allocator **>(_trusted_memory);
+    *outer_allocator_pointer_space = outer_allocator;
+
+    auto * const logger_pointer_space = reinterpret_cast<logger **>(outer_allocator_pointer_space + 1);
+    *logger_pointer_space = log;
+
+    auto * const span_size_space = reinterpret_cast<size_t *>(logger_pointer_space + 1);
+    *span_size_space = span_size;
+
+    auto * const spans_registry_pointer_space = reinterpret_cast<void ***>(span_size_space + 1);
+    *spans_registry_pointer_space = reinterpret_cast<void **>(allocate_with_guard(_initial_spans_registry_capacity * sizeof(void *)));
+
+    auto * const spans_registry_count_space = reinterpret_cast<size_t *>(spans_registry_pointer_space + 1);
+    *spans_registry_count_space = 0;
+
+    auto * const spans_registry_capacity_space = spans_registry_count_space + 1;
+    *spans_registry_capacity_space = _initial_spans_registry_capacity;
+
+    auto * const partial_slabs_lists_space = reinterpret_cast<void **>(spans_registry_capacity_space + 1);
+    std::fill(partial_slabs_lists_space, partial_slabs_lists_space + _size_classes_count, nullptr);
+
+    auto * const empty_slabs_space = partial_slabs_lists_space + _size_classes_count;
+    std::fill(empty_slabs_space, empty_slabs_space + _size_classes_count, nullptr);
+
+    this->trace_with_guard(got_typename + " allocator instance construction finished");
+}
+
+allocator_slab::~allocator_slab() noexcept
+{
+    auto got_typename = get_typename();
+    this->trace_with_guard(got_typename + " allocator instance destruction started");
+
+    auto const * const logger = get_logger();
+
+    auto ** const spans_registry = *get_spans_registry_address_address();
+    auto const spans_count = *get_spans_registry_count_address();
+
+    for (size_t i = 0; i < spans_count; i++)
+    {
+        deallocate_with_guard(spans_registry[i]);
+    }
+
+    deallocate_with_guard(spans_registry);
+    deallocate_with_guard(_trusted_memory);
+
+    if (logger != nullptr)
+    {
+        logger->trace(got_typename + " allocator instance destruction finished");
+    }
+}
+
+size_t allocator_slab::get_allocator_service_block_size() const noexcept
+{
+    auto const outer_allocator_pointer_size = sizeof(allocator *);
+    auto const logger_pointer_size = sizeof(logger *);
+    auto const span_size_size = sizeof(size_t);
+    auto const spans_registry_pointer_size = sizeof(void **);
+    auto const spans_registry_count_size = sizeof(size_t);
+    auto const spans_registry_capacity_size = sizeof(size_t);
+    auto const partial_slabs_lists_size = _size_classes_count * sizeof(void *);
+    auto const empty_slabs_size = _size_classes_count * sizeof(void *);
+
+    return outer_allocator_pointer_size + logger_pointer_size + span_size_size + spans_registry_pointer_size + spans_registry_count_size + spans_registry_capacity_size + partial_slabs_lists_size + empty_slabs_size;
+}
+
+size_t allocator_slab::get_slab_service_block_size() noexcept
+{
+    auto const object_size_size = sizeof(size_t);
+    auto const span_size_size = sizeof(size_t);
+    auto const previous_slab_pointer_size = sizeof(void *);
+    auto const next_slab_pointer_size = sizeof(void *);
+    auto const available_objects_count_size = sizeof(size_t);
+    auto const objects_count_size = sizeof(size_t);
+
+    return object_size_size + span_size_size + previous_slab_pointer_size + next_slab_pointer_size + available_objects_count_size + objects_count_size;
+}
+
+size_t allocator_slab::get_span_size() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1) + 1);
+}
+
+void ***allocator_slab::get_spans_registry_address_address() const noexcept
+{
+    return reinterpret_cast<void ***>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(allocator *) + sizeof(logger *) + sizeof(size_t));
+}
+
+size_t *allocator_slab::get_spans_registry_count_address() const noexcept
+{
+    return reinterpret_cast<size_t *>(get_spans_registry_address_address() + 1);
+}
+
+size_t *allocator_slab::get_spans_registry_capacity_address() const noexcept
+{
+    return get_spans_registry_count_address() + 1;
+}
+
+void **allocator_slab::get_partial_slabs_list_first_slab_address_address(
+    size_t size_class_index) const noexcept
+{
+    return reinterpret_cast<void **>(get_spans_registry_capacity_address() + 1) + size_class_index;
+}
+
+void **allocator_slab::get_empty_slab_address_address(
+    size_t size_class_index) const noexcept
+{
+    return get_partial_slabs_list_first_slab_address_address(_size_classes_count) + size_class_index;
+}
+
+size_t allocator_slab::get_size_class_index(
+    size_t requested_block_size) noexcept
+{
+    size_t size_class_index = 0;
+
+    for (auto size_class = _smallest_size_class; size_class < requested_block_size && size_class_index < _size_classes_count; size_class <<= 1)
+    {
+        size_class_index++;
+    }
+
+    return size_class_index;
+}
+
+size_t *allocator_slab::get_slab_object_size_address(
+    void *slab) noexcept
+{
+    return reinterpret_cast<size_t *>(slab);
+}
+
+size_t *allocator_slab::get_slab_span_size_address(
+    void *slab) noexcept
+{
+    return reinterpret_cast<size_t *>(slab) + 1;
+}
+
+void **allocator_slab::get_slab_previous_slab_address_address(
+    void *slab) noexcept
+{
+    return reinterpret_cast<void **>(get_slab_span_size_address(slab) + 1);
+}
+
+void **allocator_slab::get_slab_next_slab_address_address(
+    void *slab) noexcept
+{
+    return get_slab_previous_slab_address_address(slab) + 1;
+}
+
+size_t *allocator_slab::get_slab_available_objects_count_address(
+    void *slab) noexcept
+{
+    return reinterpret_cast<size_t *>(get_slab_next_slab_address_address(slab) + 1);
+}
+
+size_t *allocator_slab::get_slab_objects_count_address(
+    void *slab) noexcept
+{
+    return get_slab_available_objects_count_address(slab) + 1;
+}
+
+unsigned long long *allocator_slab::get_slab_bitmap_address(
+    void *slab) noexcept
+{
+    return reinterpret_cast<unsigned long long *>(reinterpret_cast<unsigned char *>(slab) + get_slab_service_block_size());
+}
+
+unsigned char *allocator_slab::get_slab_first_object_address(
+    void *slab) noexcept
+{
+    auto const bitmap_words_count = (*get_slab_objects_count_address(slab) + 63) / 64;
+    auto const first_object_offset = (get_slab_service_block_size() + bitmap_words_count * sizeof(unsigned long long) + _smallest_size_class - 1) & ~(_smallest_size_class - 1);
+
+    return reinterpret_cast<unsigned char *>(slab) + first_object_offset;
+}
+
+void *allocator_slab::create_slab(
+    size_t size_class_index)
+{
+    auto const object_size = _smallest_size_class << size_class_index;
+    auto const span_size = get_span_size();
+
+    auto objects_count = (span_size - get_slab_service_block_size()) / object_size;
+    while (((get_slab_service_block_size() + (objects_count + 63) / 64 * sizeof(unsigned long long) + _smallest_size_class - 1) & ~(_smallest_size_class - 1)) + objects_count * object_size > span_size)
+    {
+        objects_count--;
+    }
+
+    auto *slab = allocate_with_guard(span_size);
+
+    *get_slab_object_size_address(slab) = object_size;
+    *get_slab_span_size_address(slab) = span_size;
+    *get_slab_available_objects_count_address(slab) = objects_count;
+    *get_slab_objects_count_address(slab) = objects_count;
+
+    auto * const bitmap = get_slab_bitmap_address(slab);
+    auto const bitmap_words_count = (objects_count + 63) / 64;
+    std::fill(bitmap, bitmap + bitmap_words_count, ~0ull);
+    if (objects_count % 64 != 0)
+    {
+        bitmap[bitmap_words_count - 1] = (1ull << objects_count % 64) - 1;
+    }
+
+    try
+    {
+        register_span(slab);
+    }
+    catch (...)
+    {
+        deallocate_with_guard(slab);
+        throw;
+    }
+
+    insert_partial_slab(slab);
+
+    this->trace_with_guard("Created slab of " + std::to_string(objects_count) + " objects of " + std::to_string(object_size) + " bytes at " + address_to_hex(slab));
+
+    return slab;
+}
+
+void *allocator_slab::create_large_block_span(
+    size_t requested_block_size)
+{
+    auto const first_object_offset = (get_slab_service_block_size() + sizeof(unsigned long long) + _smallest_size_class - 1) & ~(_smallest_size_class - 1);
+
+    if (requested_block_size > std::numeric_limits<size_t>::max() - first_object_offset)
+    {
+        throw memory_exception("no memory available to allocate");
+    }
+
+    auto const span_size = first_object_offset + requested_block_size;
+
+    auto *span = allocate_with_guard(span_size);
+
+    *get_slab_object_size_address(span) = requested_block_size;
+    *get_slab_span_size_address(span) = span_size;
+    *get_slab_available_objects_count_address(span) = 0;
+    *get_slab_objects_count_address(span) = 1;
+    *get_slab_bitmap_address(span) = 0;
+
+    try
+    {
+        register_span(span);
+    }
+    catch (...)
+    {
+        deallocate_with_guard(span);
+        throw;
+    }
+
+    return span;
+}
+
+void allocator_slab::destroy_span(
+    void *span)
+{
+    auto ** const spans_registry = *get_spans_registry_address_address();
+    auto * const spans_count = get_spans_registry_count_address();
+    auto ** const span_position = std::lower_bound(spans_registry, spans_registry + *spans_count, span, std::less<void *>());
+
+    std::copy(span_position + 1, spans_registry + *spans_count, span_position);
+    --*spans_count;
+
+    this->trace_with_guard("Returning span at " + address_to_hex(span) + " to outer allocator");
+
+    deallocate_with_guard(span);
+}
+
+void allocator_slab::register_span(
+    void *span)
+{
+    auto * const spans_count = get_spans_registry_count_address();
+    auto * const spans_capacity = get_spans_registry_capacity_address();
+    auto *** const spans_registry_address = get_spans_registry_address_address();
+
+    if (*spans_count == *spans_capacity)
+    {
+        auto ** const grown_spans_registry = reinterpret_cast<void **>(allocate_with_guard(*spans_capacity * 2 * sizeof(void *)));
+        std::copy(*spans_registry_address, *spans_registry_address + *spans_count, grown_spans_registry);
+        deallocate_with_guard(*spans_registry_address);
+
+        *spans_registry_address = grown_spans_registry;
+        *spans_capacity *= 2;
+    }
+
+    auto ** const spans_registry = *spans_registry_address;
+    auto ** const span_position = std::upper_bound(spans_registry, spans_registry + *spans_count, span, std::less<void *>());
+
+    std::copy_backward(span_position, spans_registry + *spans_count, spans_registry + *spans_count + 1);
+    *span_position = span;
+    ++*spans_count;
+}
+
+void *allocator_slab::find_span(
+    void const *block_address) const
+{
+    auto ** const spans_registry = *get_spans_registry_address_address();
+    auto const spans_count = *get_spans_registry_count_address();
+
+    //  -  ,    
+    auto ** const next_span_position = std::upper_bound(spans_registry, spans_registry + spans_count, const_cast<void *>(block_address), std::less<void *>());
+
+    return next_span_position == spans_registry
+        ? nullptr
+        : *(next_span_position - 1);
+}
+
+void allocator_slab::insert_partial_slab(
+    void *slab)
+{
+    auto ** const first_slab_address_address = get_partial_slabs_list_first_slab_address_address(get_size_class_index(*get_slab_object_size_address(slab)));
+
+    *get_slab_previous_slab_address_address(slab) = nullptr;
+    *get_slab_next_slab_address_address(slab) = *first_slab_address_address;
+
+    if (*first_slab_address_address != nullptr)
+    {
+        *get_slab_previous_slab_address_address(*first_slab_address_address) = slab;
+    }
+
+    *first_slab_address_address = slab;
+}
+
+void allocator_slab::remove_partial_slab(
+    void *slab)
+{
+    auto * const previous_slab = *get_slab_previous_slab_address_address(slab);
+    auto * const next_slab = *get_slab_next_slab_address_address(slab);
+
+    previous_slab == nullptr
+        ? *get_partial_slabs_list_first_slab_address_address(get_size_class_index(*get_slab_object_size_address(slab))) = next_slab
+        : *get_slab_next_slab_address_address(previous_slab) = next_slab;
+
+    if (next_slab != nullptr)
+    {
+        *get_slab_previous_slab_address_address(next_slab) = previous_slab;
+    }
+}
+
+void allocator_slab::dump_trusted_memory_blocks_state() const
+{
+    if (get_logger() == nullptr)
+    {
+        return;
+    }
+
+    std::string to_dump("|");
+    auto ** const spans_registry = *get_spans_registry_address_address();
+    auto const spans_count = *get_spans_registry_count_address();
+
+    for (size_t i = 0; i < spans_count; i++)
+    {
+        auto const objects_count = *get_slab_objects_count_address(spans_registry[i]);
+
+        to_dump += std::to_string(*get_slab_object_size_address(spans_registry[i])) + " " +
+            std::to_string(objects_count - *get_slab_available_objects_count_address(spans_registry[i])) + "/" + std::to_string(objects_count) + "|";
+    }
+
+    this->debug_with_guard("Memory state: " + to_dump);
+}
+
+size_t allocator_slab::get_natural_alignment() const noexcept
+{
+    return std::min(get_natural_alignment_with_guard(), alignof(size_t));
+}
+
+void *allocator_slab::allocate(
+    size_t requested_block_size)
+{
+    auto const got_typename = get_typename();
+    this->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution started")
+        ->debug_with_guard("Requested " + std::to_string(requested_block_size) + " bytes of memory");
+
+    auto const size_class_index = get_size_class_index(requested_block_size);
+    void *allocated_block;
+
+    try
+    {
+        if (size_class_index == _size_classes_count)
+        {
+            allocated_block = get_slab_first_object_address(create_large_block_span(requested_block_size));
+        }
+        else
+        {
+            auto *slab = *get_partial_slabs_list_first_slab_address_address(size_class_index);
+            if (slab == nullptr)
+            {
+                slab = create_slab(size_class_index);
+            }
+
+            auto ** const empty_slab_address_address = get_empty_slab_address_address(size_class_index);
+            if (*empty_slab_address_address == slab)
+            {
+                *empty_slab_address_address = nullptr;
+            }
+
+            auto * const bitmap = get_slab_bitmap_address(slab);
+            size_t bitmap_word_index = 0;
+            while (bitmap[bitmap_word_index] == 0)
+            {
+                bitmap_word_index++;
+            }
+
+            auto const bit_index = get_lowest_set_bit_index(bitmap[bitmap_word_index]);
+            bitmap[bitmap_word_index] &= ~(1ull << bit_index);
+
+            if (--*get_slab_available_objects_count_address(slab) == 0)
+            {
+                remove_partial_slab(slab);
+            }
+
+            allocated_block = get_slab_first_object_address(slab) + (bitmap_word_index * 64 + bit_index) * *get_slab_object_size_address(slab);
+        }
+    }
+    catch (std::exception const &)
+    {
+        auto const warning_message = "no memory available to allocate";
+
+        this->warning_with_guard(warning_message)
+            ->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution finished");
+
+        throw memory_exception(warning_message);
+    }
+
+    this->trace_with_guard("Allocated block placed at " + address_to_hex(allocated_block))
+        ->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution finished");
+
+    dump_trusted_memory_blocks_state();
+    return allocated_block;
+}
+
+void allocator_slab::deallocate_from_span(
+    void *span,
+    void *block_to_deallocate_address,
+    size_t size_class_index)
+{
+    if (size_class_index == _size_classes_count)
+    {
+        destroy_span(span);
+        return;
+    }
+
+    auto const object_index = (reinterpret_cast<unsigned char *>(block_to_deallocate_address) - get_slab_first_object_address(span)) / (_smallest_size_class << size_class_index);
+    get_slab_bitmap_address(span)[object_index / 64] |= 1ull << object_index % 64;
+
+    auto * const available_objects_count = get_slab_available_objects_count_address(span);
+
+    if ((*available_objects_count)++ == 0)
+    {
+        insert_partial_slab(span);
+    }
+
+    if (*available_objects_count == *get_slab_objects_count_address(span))
+    {
+        //      ,              
+        auto ** const empty_slab_address_address = get_empty_slab_address_address(size_class_index);
+        if (*empty_slab_address_address == nullptr)
+        {
+            *empty_slab_address_address = span;
+            return;
+        }
+
+        remove_partial_slab(span);
+        destroy_span(span);
+    }
+}
+
+void allocator_slab::deallocate(
+    void *block_to_deallocate_address)
+{
+    auto const got_typename = get_typename();
+    this->trace_with_guard(got_typename + "::deallocate(void *block_to_deallocate_address) execution started");
+
+    auto * const span = find_span(block_to_deallocate_address);
+
+    deallocate_from_span(span, block_to_deallocate_address, get_size_class_index(*get_slab_object_size_address(span)));
+
+    this->debug_with_guard("After `deallocate` (addr == " + address_to_hex(block_to_deallocate_address) + "):");
+    dump_trusted_memory_blocks_state();
+    this->trace_with_guard(got_typename + "::deallocate method execution finished");
+}
+
+void allocator_slab::deallocate(
+    void *block_to_deallocate_address,
+    size_t block_size)
+{
+    auto const got_typename = get_typename();
+    this->trace_with_guard(got_typename + "::deallocate(void *block_to_deallocate_address, size_t block_size) execution started");
+
+    auto * const span = find_span(block_to_deallocate_address);
+    auto const size_class_index = get_size_class_index(block_size);
+
+#ifdef _DEBUG
+    //   (  )      
+    auto const object_size = *get_slab_object_size_address(span);
+    if (size_class_index == _size_classes_count
+        ? object_size != block_size
+        : object_size != _smallest_size_class << size_class_index)
+    {
+        auto const error_message = "deallocated block size " + std::to_string(block_size) + " bytes does not match allocated object size " + std::to_string(object_size) + " bytes";
+
+        this->error_with_guard(error_message)
+            ->trace_with_guard(got_typename + "::deallocate method execution finished");
+
+        throw std::invalid_argument(error_message);
+    }
+#endif
+
+    deallocate_from_span(span, block_to_deallocate_address, size_class_index);
+
+    this->debug_with_guard("After `deallocate` (addr == " + address_to_hex(block_to_deallocate_address) + "):");
+    dump_trusted_memory_blocks_state();
+    this->trace_with_guard(got_typename + "::deallocate method execution finished");
+}
+
+void *allocator_slab::reallocate(
+    void *block_to_reallocate_address,
+    size_t new_block_size)
+{
+    auto const block_size = *get_slab_object_size_address(find_span(block_to_reallocate_address));
+
+    if (block_size <= _smallest_size_class << (_size_classes_count - 1) && get_size_class_index(new_block_size) == get_size_class_index(block_size))
+    {
+        return block_to_reallocate_address;
+    }
+
+    auto * new_block = allocate(new_block_size);
+    memcpy(new_block, block_to_reallocate_address, std::min(block_size, new_block_size));
+    deallocate(block_to_reallocate_address);
+    return new_block;
+}
+
+bool allocator_slab::reallocate(
+    void **block_to_reallocate_address_address,
+    size_t new_block_size)
+{
+    try {
+        *block_to_reallocate_address_address = reallocate(*block_to_reallocate_address_address, new_block_size);
+        return true;
+    }
+    catch (std::exception const &ex)
+    {
+        this->warning_with_guard(ex.what());
+        return false;
+    }
+}
+
+logger *allocator_slab::get_logger() const noexcept
+{
+    return *reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1);
+}
+
+std::string allocator_slab::get_typename() const noexcept
+{
+    return "allocator_slab";
+}
+
+allocator *allocator_slab::get_allocator() const noexcept
+{
+    return *reinterpret_cast<allocator **>(_trusted_memory);
+}
\ No newline at end of file
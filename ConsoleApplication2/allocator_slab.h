@@ -0,0 +1,198 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_SLABS_H
+#define DATA_STRUCTURES_CPP_MEMORY_WITH_SLABS_H
+
+#include "typename_holder.h"
+#include "logger.h"
+#include "logger_holder.h"
+#include "allocator.h"
+#include "allocator_holder.h"
+
+class allocator_slab final:
+    public allocator,
+    protected logger_holder,
+    protected typename_holder,
+    protected allocator_holder
+{
+
+private:
+
+    //     ( -  ).
+    static constexpr size_t _smallest_size_class = 16;
+
+    //   (16..1024 );     .
+    static constexpr size_t _size_classes_count = 7;
+
+    //  ,    .
+    static constexpr size_t _minimal_span_size = 8192;
+
+    //   .
+    static constexpr size_t _initial_spans_registry_capacity = 16;
+
+private:
+
+    void *_trusted_memory;
+
+public:
+
+    // ,   outer_allocator   span_size         .
+    explicit allocator_slab(
+        allocator *outer_allocator = nullptr,
+        logger *logger = nullptr,
+        size_t span_size = 16384);
+
+    allocator_slab(
+        allocator_slab const &other) = delete;
+
+    allocator_slab &operator=(
+        allocator_slab const &other) = delete;
+
+    // .         .
+    ~allocator_slab() noexcept;
+
+private:
+
+    //     .
+    [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override;
+
+    //        .
+    [[nodiscard]] static size_t get_slab_service_block_size() noexcept;
+
+    //  ,    .
+    [[nodiscard]] size_t get_span_size() const noexcept;
+
+    //     ,   .
+    [[nodiscard]] void ***get_spans_registry_address_address() const noexcept;
+
+    //     .
+    [[nodiscard]] size_t *get_spans_registry_count_address() const noexcept;
+
+    //    .
+    [[nodiscard]] size_t *get_spans_registry_capacity_address() const noexcept;
+
+    //          size_class_index.
+    [[nodiscard]] void **get_partial_slabs_list_first_slab_address_address(
+        size_t size_class_index) const noexcept;
+
+    //        size_class_index,      .
+    [[nodiscard]] void **get_empty_slab_address_address(
+        size_t size_class_index) const noexcept;
+
+    //       requested_block_size (_size_classes_count,     ).
+    [[nodiscard]] static size_t get_size_class_index(
+        size_t requested_block_size) noexcept;
+
+    //    .
+    [[nodiscard]] static size_t *get_slab_object_size_address(
+        void *slab) noexcept;
+
+    //   ,  .
+    [[nodiscard]] static size_t *get_slab_span_size_address(
+        void *slab) noexcept;
+
+    //          .
+    [[nodiscard]] static void **get_slab_previous_slab_address_address(
+        void *slab) noexcept;
+
+    //          .
+    [[nodiscard]] static void **get_slab_next_slab_address_address(
+        void *slab) noexcept;
+
+    //     .
+    [[nodiscard]] static size_t *get_slab_available_objects_count_address(
+        void *slab) noexcept;
+
+    //    .
+    [[nodiscard]] static size_t *get_slab_objects_count_address(
+        void *slab) noexcept;
+
+    //       (  -  ).
+    [[nodiscard]] static unsigned long long *get_slab_bitmap_address(
+        void *slab) noexcept;
+
+    //    .
+    [[nodiscard]] static unsigned char *get_slab_first_object_address(
+        void *slab) noexcept;
+
+    //         size_class_index   .
+    [[nodiscard]] void *create_slab(
+        size_t size_class_index);
+
+    //         requested_block_size   .
+    [[nodiscard]] void *create_large_block_span(
+        size_t requested_block_size);
+
+    //        .
+    void destroy_span(
+        void *span);
+
+    //    ,    .
+    void register_span(
+        void *span);
+
+    // ,      block_address.
+    [[nodiscard]] void *find_span(
+        void const *block_address) const;
+
+    //    block_to_deallocate_address  span   size_class_index (    ).
+    void deallocate_from_span(
+        void *span,
+        void *block_to_deallocate_address,
+        size_t size_class_index);
+
+    //          .
+    void insert_partial_slab(
+        void *slab);
+
+    //         .
+    void remove_partial_slab(
+        void *slab);
+
+    //     allocator_slab (    ).
+    void dump_trusted_memory_blocks_state() const override;
+
+public:
+
+    //  :      8 ,     ,     .
+    [[nodiscard]] size_t get_natural_alignment() const noexcept override;
+
+    //    ,    .
+    void *allocate(
+        size_t requested_block_size) override;
+
+    //    block_to_deallocate_address;     ,        .
+    void deallocate(
+        void *block_to_deallocate_address) override;
+
+    //   block_size;     block_size    .
+    void deallocate(
+        void *block_to_deallocate_address,
+        size_t block_size) override;
+
+    //  ,     new_block_size.        ,   .
+    [[nodiscard]] void *reallocate(
+        void *block_to_reallocate_address,
+        size_t new_block_size) override;
+
+    //      .    ,    .
+    bool reallocate(
+        void **block_to_reallocate_address_address,
+        size_t new_block_size) override;
+
+private:
+
+    //    logger,    .
+    [[nodiscard]] logger *get_logger() const noexcept override;
+
+private:
+
+    //     (allocator_slab).
+    [[nodiscard]] std::string get_typename() const noexcept override;
+
+private:
+
+    //     (  ).
+    [[nodiscard]] allocator *get_allocator() const noexcept override;
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_WITH_SLABS_H
\ No newline at end of file
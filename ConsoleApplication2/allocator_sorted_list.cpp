@@ -1,10 +1,16 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
 #include "allocator_sorted_list.h"
 
 allocator_sorted_list::allocator_sorted_list(
     size_t memory_size,
     allocator *outer_allocator,
     logger *log,
-    allocator_fit_allocation::allocation_mode allocation_mode)
+    allocator_fit_allocation::allocation_mode allocation_mode,
+    bool growable)
 {
     auto got_typename = get_typename();
 
@@ -14,7 +20,7 @@ allocator_sorted_list::allocator_sorted_list(
             ->debug("requested memory size: " + std::to_string(memory_size) + " bytes");
     }
 
-    auto const minimal_trusted_memory_size = get_available_block_service_block_size();
+    auto const minimal_trusted_memory_size = get_available_block_service_block_size(allocation_mode);
 
     if (memory_size < minimal_trusted_memory_size)
     {
@@ -47,14 +53,41 @@ allocator_sorted_list::allocator_sorted_list(
     *allocation_mode_space = allocation_mode;
 
     auto * const first_available_block_pointer_space = reinterpret_cast<void **>(allocation_mode_space + 1);
-    *first_available_block_pointer_space = reinterpret_cast<void *>(first_available_block_pointer_space + 1);
 
-    auto * const first_available_block_size_space = reinterpret_cast<size_t *>(*first_available_block_pointer_space);
-    *first_available_block_size_space = memory_size;
+    auto * const available_blocks_bins_bitmap_space = reinterpret_cast<unsigned long long *>(first_available_block_pointer_space + 1);
+    *available_blocks_bins_bitmap_space = 0;
+
+    auto * const available_blocks_bins_space = reinterpret_cast<void **>(available_blocks_bins_bitmap_space + 1);
+    std::fill(available_blocks_bins_space, available_blocks_bins_space + _available_blocks_bins_count, nullptr);
+
+    auto * const first_extra_segment_pointer_space = available_blocks_bins_space + _available_blocks_bins_count;
+    *first_extra_segment_pointer_space = nullptr;
+
+    auto * const growable_space = reinterpret_cast<size_t *>(first_extra_segment_pointer_space + 1);
+    *growable_space = growable ? 1 : 0;
+
+    auto * const default_alignment_space = growable_space + 1;
+    *default_alignment_space = 1;
+
+    auto * const next_fit_rover_pointer_space = reinterpret_cast<void **>(default_alignment_space + 1);
+    *next_fit_rover_pointer_space = nullptr;
+
+    auto * const first_available_block_size_space = reinterpret_cast<size_t *>(next_fit_rover_pointer_space + 1);
+    write_block_tags(first_available_block_size_space, memory_size, _block_available_flag | _last_block_flag);
 
     auto * const first_available_block_next_block_address_space = reinterpret_cast<void **>(first_available_block_size_space + 1);
     *first_available_block_next_block_address_space = nullptr;
 
+    if (allocation_mode == allocator_fit_allocation::allocation_mode::segregated_fit)
+    {
+        *first_available_block_pointer_space = nullptr;
+        insert_available_block_into_bins(first_available_block_size_space);
+    }
+    else
+    {
+        *first_available_block_pointer_space = reinterpret_cast<void *>(first_available_block_size_space);
+    }
+
     this->trace_with_guard(got_typename + " allocator instance construction finished");
 }
 
@@ -65,6 +98,14 @@ allocator_sorted_list::~allocator_sorted_list() noexcept
 
     auto const * const logger = get_logger();
 
+    auto *current_extra_segment = *get_first_extra_segment_address_address();
+    while (current_extra_segment != nullptr)
+    {
+        auto * const next_extra_segment = *reinterpret_cast<void **>(reinterpret_cast<size_t *>(current_extra_segment) + 1);
+        deallocate_with_guard(current_extra_segment);
+        current_extra_segment = next_extra_segment;
+    }
+
     deallocate_with_guard(_trusted_memory);
 
     if (logger != nullptr)
@@ -83,138 +124,992 @@ allocator_fit_allocation::allocation_mode allocator_sorted_list::get_allocation_
     return *reinterpret_cast<allocator_fit_allocation::allocation_mode *>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *));
 }
 
-size_t allocator_sorted_list::get_allocator_service_block_size() const noexcept
-{
-    auto const memory_size_size = sizeof(size_t);
-    auto const outer_allocator_pointer_size = sizeof(allocator *);
-    auto const logger_pointer_size = sizeof(logger *);
-    auto const allocation_mode_size = sizeof(allocator_fit_allocation::allocation_mode);
-    auto const first_available_block_pointer_size = sizeof(void *);
+size_t allocator_sorted_list::get_allocator_service_block_size() const noexcept
+{
+    auto const memory_size_size = sizeof(size_t);
+    auto const outer_allocator_pointer_size = sizeof(allocator *);
+    auto const logger_pointer_size = sizeof(logger *);
+    auto const allocation_mode_size = sizeof(allocator_fit_allocation::allocation_mode);
+    auto const first_available_block_pointer_size = sizeof(void *);
+    auto const available_blocks_bins_bitmap_size = sizeof(unsigned long long);
+    auto const available_blocks_bins_size = sizeof(void *) * _available_blocks_bins_count;
+    auto const first_extra_segment_pointer_size = sizeof(void *);
+    auto const growable_size = sizeof(size_t);
+    auto const default_alignment_size = sizeof(size_t);
+    auto const next_fit_rover_pointer_size = sizeof(void *);
+
+    return memory_size_size + outer_allocator_pointer_size + logger_pointer_size + allocation_mode_size + first_available_block_pointer_size +
+        available_blocks_bins_bitmap_size + available_blocks_bins_size + first_extra_segment_pointer_size + growable_size + default_alignment_size +
+        next_fit_rover_pointer_size;
+}
+
+size_t allocator_sorted_list::get_available_block_service_block_size() const noexcept
+{
+    return get_available_block_service_block_size(get_allocation_mode());
+}
+
+size_t allocator_sorted_list::get_available_block_service_block_size(
+    allocator_fit_allocation::allocation_mode allocation_mode) noexcept
+{
+    auto const current_block_size = sizeof(size_t);
+    auto const next_available_block_pointer_size = sizeof(void *);
+
+    if (allocation_mode != allocator_fit_allocation::allocation_mode::segregated_fit)
+    {
+        return current_block_size + next_available_block_pointer_size;
+    }
+
+    auto const previous_available_block_pointer_size = sizeof(void *);
+    auto const current_block_size_tag_size = sizeof(size_t);
+
+    return current_block_size + next_available_block_pointer_size + previous_available_block_pointer_size + current_block_size_tag_size;
+}
+
+size_t allocator_sorted_list::get_occupied_block_service_block_size() const noexcept
+{
+    auto const current_block_size = sizeof(size_t);
+
+    return current_block_size;
+}
+
+size_t allocator_sorted_list::get_occupied_block_minimal_data_size() const noexcept
+{
+    return get_available_block_service_block_size() - get_occupied_block_service_block_size();
+}
+
+size_t allocator_sorted_list::get_block_flags(
+    void const *block_address) noexcept
+{
+    return *reinterpret_cast<size_t const *>(block_address) & _block_flags_mask;
+}
+
+void allocator_sorted_list::write_block_tags(
+    void *block_address,
+    size_t block_size,
+    size_t block_flags) const noexcept
+{
+    if (get_allocation_mode() != allocator_fit_allocation::allocation_mode::segregated_fit)
+    {
+        *reinterpret_cast<size_t *>(block_address) = block_size;
+        return;
+    }
+
+    *reinterpret_cast<size_t *>(block_address) = block_size | block_flags;
+
+    if ((block_flags & _block_available_flag) != 0)
+    {
+        *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(block_address) + block_size - sizeof(size_t)) = block_size;
+    }
+
+    if ((block_flags & _last_block_flag) == 0)
+    {
+        auto * const next_block_size_address = reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(block_address) + block_size);
+
+        (block_flags & _block_available_flag) != 0
+            ? *next_block_size_address |= _previous_block_available_flag
+            : *next_block_size_address &= ~_previous_block_available_flag;
+    }
+}
+
+void allocator_sorted_list::rewrite_blocks_tags(
+    std::vector<void *> const &available_blocks,
+    bool tagged) const
+{
+    auto memory_size = get_trusted_memory_size();
+    unsigned char *first_block = reinterpret_cast<unsigned char *>(_trusted_memory) + get_allocator_service_block_size();
+    auto *current_extra_segment = *get_first_extra_segment_address_address();
+
+    while (true)
+    {
+        size_t previous_block_available_flag = 0;
+
+        for (auto *current_block = first_block; static_cast<size_t>(current_block - first_block) < memory_size;)
+        {
+            auto * const current_block_size_address = reinterpret_cast<size_t *>(current_block);
+            auto const current_block_size = *current_block_size_address & ~_block_flags_mask;
+            auto * const next_block = current_block + current_block_size;
+
+            *current_block_size_address = current_block_size;
+
+            if (tagged)
+            {
+                auto const block_available_flag = std::binary_search(available_blocks.begin(), available_blocks.end(), current_block)
+                    ? _block_available_flag
+                    : 0;
+
+                *current_block_size_address |= block_available_flag | previous_block_available_flag | (static_cast<size_t>(next_block - first_block) == memory_size
+                    ? _last_block_flag
+                    : 0);
+
+                if (block_available_flag != 0)
+                {
+                    *reinterpret_cast<size_t *>(next_block - sizeof(size_t)) = current_block_size;
+                }
+
+                previous_block_available_flag = block_available_flag == 0
+                    ? 0
+                    : _previous_block_available_flag;
+            }
+
+            current_block = next_block;
+        }
+
+        if (current_extra_segment == nullptr)
+        {
+            break;
+        }
+
+        memory_size = *reinterpret_cast<size_t *>(current_extra_segment);
+        first_block = reinterpret_cast<unsigned char *>(current_extra_segment) + get_extra_segment_service_block_size();
+        current_extra_segment = *reinterpret_cast<void **>(reinterpret_cast<size_t *>(current_extra_segment) + 1);
+    }
+}
+
+size_t allocator_sorted_list::get_smallest_block_size() const noexcept
+{
+    auto smallest_block_size = std::numeric_limits<size_t>::max();
+    auto memory_size = get_trusted_memory_size();
+    auto const *first_block = reinterpret_cast<unsigned char const *>(_trusted_memory) + get_allocator_service_block_size();
+    auto *current_extra_segment = *get_first_extra_segment_address_address();
+
+    while (true)
+    {
+        for (auto const *current_block = first_block; static_cast<size_t>(current_block - first_block) < memory_size;)
+        {
+            auto const current_block_size = *reinterpret_cast<size_t const *>(current_block) & ~_block_flags_mask;
+
+            smallest_block_size = std::min(smallest_block_size, current_block_size);
+            current_block += current_block_size;
+        }
+
+        if (current_extra_segment == nullptr)
+        {
+            return smallest_block_size;
+        }
+
+        memory_size = *reinterpret_cast<size_t *>(current_extra_segment);
+        first_block = reinterpret_cast<unsigned char const *>(current_extra_segment) + get_extra_segment_service_block_size();
+        current_extra_segment = *reinterpret_cast<void **>(reinterpret_cast<size_t *>(current_extra_segment) + 1);
+    }
+}
+
+void **allocator_sorted_list::get_first_available_block_address_address() const noexcept
+{
+    return reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *) + sizeof(allocator_fit_allocation::allocation_mode));
+}
+
+void *allocator_sorted_list::get_first_available_block_address() const noexcept
+{
+    return *get_first_available_block_address_address();
+}
+
+unsigned long long *allocator_sorted_list::get_available_blocks_bins_bitmap_address() const noexcept
+{
+    return reinterpret_cast<unsigned long long *>(get_first_available_block_address_address() + 1);
+}
+
+void **allocator_sorted_list::get_available_blocks_bin_first_block_address_address(
+    size_t bin_index) const noexcept
+{
+    return reinterpret_cast<void **>(get_available_blocks_bins_bitmap_address() + 1) + bin_index;
+}
+
+void **allocator_sorted_list::get_first_extra_segment_address_address() const noexcept
+{
+    return get_available_blocks_bin_first_block_address_address(0) + _available_blocks_bins_count;
+}
+
+bool allocator_sorted_list::is_growable() const noexcept
+{
+    return *reinterpret_cast<size_t *>(get_first_extra_segment_address_address() + 1) != 0;
+}
+
+size_t allocator_sorted_list::get_default_alignment() const noexcept
+{
+    return *(reinterpret_cast<size_t *>(get_first_extra_segment_address_address() + 1) + 1);
+}
+
+void **allocator_sorted_list::get_next_fit_rover_address_address() const noexcept
+{
+    return reinterpret_cast<void **>(reinterpret_cast<size_t *>(get_first_extra_segment_address_address() + 1) + 2);
+}
+
+void allocator_sorted_list::replace_next_fit_rover(
+    void const *block_address,
+    void *replacement_block_address) const noexcept
+{
+    auto ** const next_fit_rover_address_address = get_next_fit_rover_address_address();
+
+    if (*next_fit_rover_address_address == block_address)
+    {
+        *next_fit_rover_address_address = replacement_block_address;
+    }
+}
+
+size_t allocator_sorted_list::get_available_block_aligned_block_offset(
+    void const *block_address,
+    size_t alignment) const noexcept
+{
+    auto const payload_address = reinterpret_cast<uintptr_t>(block_address) + get_occupied_block_service_block_size();
+    auto block_offset = static_cast<size_t>((alignment - payload_address % alignment) % alignment);
+
+    //            ,   
+    while (block_offset != 0 && block_offset < get_available_block_service_block_size())
+    {
+        block_offset += alignment;
+    }
+
+    return block_offset;
+}
+
+size_t allocator_sorted_list::get_extra_segment_service_block_size() const noexcept
+{
+    auto const segment_size_size = sizeof(size_t);
+    auto const next_segment_pointer_size = sizeof(void *);
+
+    return segment_size_size + next_segment_pointer_size;
+}
+
+void allocator_sorted_list::attach_extra_segment(
+    size_t required_block_size)
+{
+    auto ** const first_extra_segment_address_address = get_first_extra_segment_address_address();
+    auto const last_segment_size = *first_extra_segment_address_address == nullptr
+        ? get_trusted_memory_size()
+        : *reinterpret_cast<size_t *>(*first_extra_segment_address_address);
+
+    //  ,        
+    auto segment_size = last_segment_size << 1;
+    if (segment_size < required_block_size)
+    {
+        segment_size = required_block_size;
+    }
+
+    this->debug_with_guard("Attaching extra segment of " + std::to_string(segment_size) + " bytes");
+
+    auto * const segment = allocate_with_guard(segment_size + get_extra_segment_service_block_size());
+
+    auto * const segment_size_space = reinterpret_cast<size_t *>(segment);
+    *segment_size_space = segment_size;
+
+    auto * const next_segment_pointer_space = reinterpret_cast<void **>(segment_size_space + 1);
+    *next_segment_pointer_space = *first_extra_segment_address_address;
+    *first_extra_segment_address_address = segment;
+
+    //         ,      
+    auto * const available_block_size_space = reinterpret_cast<size_t *>(next_segment_pointer_space + 1);
+    write_block_tags(available_block_size_space, segment_size, _block_available_flag | _last_block_flag);
+
+    get_allocation_mode() == allocator_fit_allocation::allocation_mode::segregated_fit
+        ? insert_available_block_into_bins(available_block_size_space)
+        : insert_available_block_into_list(available_block_size_space);
+}
+
+void allocator_sorted_list::release_extra_segment_if_available(
+    void *available_block_address)
+{
+    void *previous_segment = nullptr, *current_segment = *get_first_extra_segment_address_address();
+    auto const extra_segment_service_block_size = get_extra_segment_service_block_size();
+
+    while (current_segment != nullptr && reinterpret_cast<unsigned char *>(current_segment) + extra_segment_service_block_size != available_block_address)
+    {
+        previous_segment = current_segment;
+        current_segment = *reinterpret_cast<void **>(reinterpret_cast<size_t *>(current_segment) + 1);
+    }
+
+    if (current_segment == nullptr || get_available_block_size(available_block_address) != *reinterpret_cast<size_t *>(current_segment))
+    {
+        return;
+    }
+
+    release_extra_segment(previous_segment, current_segment);
+}
+
+void allocator_sorted_list::release_extra_segment(
+    void *previous_segment,
+    void *segment)
+{
+    auto * const segment_first_block = reinterpret_cast<unsigned char *>(segment) + get_extra_segment_service_block_size();
+
+    get_allocation_mode() == allocator_fit_allocation::allocation_mode::segregated_fit
+        ? remove_available_block_from_bins(segment_first_block)
+        : remove_available_block_from_list(segment_first_block);
+
+    auto * const next_segment = *reinterpret_cast<void **>(reinterpret_cast<size_t *>(segment) + 1);
+    previous_segment == nullptr
+        ? *get_first_extra_segment_address_address() = next_segment
+        : *reinterpret_cast<void **>(reinterpret_cast<size_t *>(previous_segment) + 1) = next_segment;
+
+    this->debug_with_guard("Releasing extra segment of " + std::to_string(*reinterpret_cast<size_t *>(segment)) + " bytes");
+
+    deallocate_with_guard(segment);
+}
+
+void allocator_sorted_list::insert_available_block_into_list(
+    void *block_address)
+{
+    void *previous_block = nullptr, *current_block = get_first_available_block_address();
+    while (current_block != nullptr && current_block < block_address)
+    {
+        previous_block = current_block;
+        current_block = get_available_block_next_available_block_address(current_block);
+    }
+
+    *reinterpret_cast<void **>(reinterpret_cast<size_t *>(block_address) + 1) = current_block;
+
+    previous_block == nullptr
+        ? *get_first_available_block_address_address() = block_address
+        : *reinterpret_cast<void **>(reinterpret_cast<size_t *>(previous_block) + 1) = block_address;
+}
+
+void allocator_sorted_list::remove_available_block_from_list(
+    void *block_address)
+{
+    void *previous_block = nullptr, *current_block = get_first_available_block_address();
+    while (current_block != block_address)
+    {
+        previous_block = current_block;
+        current_block = get_available_block_next_available_block_address(current_block);
+    }
+
+    replace_next_fit_rover(block_address, previous_block);
+
+    previous_block == nullptr
+        ? *get_first_available_block_address_address() = get_available_block_next_available_block_address(block_address)
+        : *reinterpret_cast<void **>(reinterpret_cast<size_t *>(previous_block) + 1) = get_available_block_next_available_block_address(block_address);
+}
+
+size_t allocator_sorted_list::get_available_block_bin_index(
+    size_t block_size) noexcept
+{
+    auto const small_bins_upper_bound = _available_blocks_small_bins_count << 3;
+
+    if (block_size < small_bins_upper_bound)
+    {
+        return block_size >> 3;
+    }
+
+    size_t power = 3;
+    while ((_available_blocks_small_bins_count << (power + 1)) <= block_size && power - 3 < _available_blocks_bins_count - _available_blocks_small_bins_count - 1)
+    {
+        ++power;
+    }
+
+    return _available_blocks_small_bins_count + power - 3;
+}
+
+size_t allocator_sorted_list::get_requested_block_bin_index(
+    size_t block_size) noexcept
+{
+    auto const small_bins_upper_bound = _available_blocks_small_bins_count << 3;
+
+    if (block_size < small_bins_upper_bound)
+    {
+        //         block_size
+        return (block_size + 7) >> 3;
+    }
+
+    return get_available_block_bin_index(block_size);
+}
+
+void **allocator_sorted_list::get_available_block_previous_available_block_address_address(
+    void *block_address) noexcept
+{
+    return reinterpret_cast<void **>(reinterpret_cast<size_t *>(block_address) + 1) + 1;
+}
+
+void allocator_sorted_list::insert_available_block_into_bins(
+    void *block_address)
+{
+    auto const bin_index = get_available_block_bin_index(get_available_block_size(block_address));
+    auto ** const bin_first_block_address_address = get_available_blocks_bin_first_block_address_address(bin_index);
+    auto * const bin_first_block = *bin_first_block_address_address;
+
+    *reinterpret_cast<void **>(reinterpret_cast<size_t *>(block_address) + 1) = bin_first_block;
+    *get_available_block_previous_available_block_address_address(block_address) = nullptr;
+
+    if (bin_first_block != nullptr)
+    {
+        *get_available_block_previous_available_block_address_address(bin_first_block) = block_address;
+    }
+
+    *bin_first_block_address_address = block_address;
+    *get_available_blocks_bins_bitmap_address() |= 1ULL << bin_index;
+}
+
+void allocator_sorted_list::remove_available_block_from_bins(
+    void *block_address)
+{
+    auto const bin_index = get_available_block_bin_index(get_available_block_size(block_address));
+    auto ** const bin_first_block_address_address = get_available_blocks_bin_first_block_address_address(bin_index);
+
+    // ,       
+    auto * const previous_block = *get_available_block_previous_available_block_address_address(block_address);
+    auto * const next_block = get_available_block_next_available_block_address(block_address);
+
+    previous_block == nullptr
+        ? *bin_first_block_address_address = next_block
+        : *reinterpret_cast<void **>(reinterpret_cast<size_t *>(previous_block) + 1) = next_block;
+
+    if (next_block != nullptr)
+    {
+        *get_available_block_previous_available_block_address_address(next_block) = previous_block;
+    }
+
+    if (*bin_first_block_address_address == nullptr)
+    {
+        *get_available_blocks_bins_bitmap_address() &= ~(1ULL << bin_index);
+    }
+}
+
+void *allocator_sorted_list::take_available_block_from_bins(
+    size_t required_block_size)
+{
+    auto * const bins_bitmap = get_available_blocks_bins_bitmap_address();
+    auto bin_index = get_requested_block_bin_index(required_block_size);
+
+    //       ,    
+    auto *current_block = *get_available_blocks_bin_first_block_address_address(bin_index);
+    while (current_block != nullptr && get_available_block_size(current_block) < required_block_size)
+    {
+        current_block = get_available_block_next_available_block_address(current_block);
+    }
+
+    if (current_block == nullptr)
+    {
+        auto const upper_bins_bitmap = bin_index + 1 == _available_blocks_bins_count
+            ? 0ULL
+            : *bins_bitmap & (~0ULL << (bin_index + 1));
+
+        if (upper_bins_bitmap == 0)
+        {
+            return nullptr;
+        }
+
+        current_block = *get_available_blocks_bin_first_block_address_address(get_lowest_set_bit_index(upper_bins_bitmap));
+    }
+
+    remove_available_block_from_bins(current_block);
+
+    return current_block;
+}
+
+void *allocator_sorted_list::deallocate_into_bins(
+    void *block_to_deallocate_address)
+{
+    auto block_to_deallocate_size = get_occupied_block_size(block_to_deallocate_address);
+    auto block_to_deallocate_flags = get_block_flags(block_to_deallocate_address);
+
+    //       ,   
+    if ((block_to_deallocate_flags & _last_block_flag) == 0)
+    {
+        auto * const next_block = reinterpret_cast<unsigned char *>(block_to_deallocate_address) + block_to_deallocate_size;
+
+        if ((get_block_flags(next_block) & _block_available_flag) != 0)
+        {
+            this->trace_with_guard("Merging next available block with target block...");
+            remove_available_block_from_bins(next_block);
+            block_to_deallocate_size += get_available_block_size(next_block);
+            block_to_deallocate_flags |= get_block_flags(next_block) & _last_block_flag;
+            this->trace_with_guard("Merging completed");
+        }
+    }
+
+    if ((block_to_deallocate_flags & _previous_block_available_flag) != 0)
+    {
+        auto * const previous_block = reinterpret_cast<unsigned char *>(block_to_deallocate_address) - *(reinterpret_cast<size_t *>(block_to_deallocate_address) - 1);
+
+        this->trace_with_guard("Merging previous available block with target block...");
+        remove_available_block_from_bins(previous_block);
+        block_to_deallocate_size += get_available_block_size(previous_block);
+        block_to_deallocate_flags = (block_to_deallocate_flags & _last_block_flag) | (get_block_flags(previous_block) & _previous_block_available_flag);
+        block_to_deallocate_address = previous_block;
+        this->trace_with_guard("Merging completed");
+    }
+
+    write_block_tags(block_to_deallocate_address, block_to_deallocate_size, block_to_deallocate_flags | _block_available_flag);
+    insert_available_block_into_bins(block_to_deallocate_address);
+
+    return block_to_deallocate_address;
+}
+
+void *allocator_sorted_list::get_adjacent_available_block_address(
+    void const *block_address) const
+{
+    auto const * const adjacent_block_address = reinterpret_cast<unsigned char const *>(block_address) + get_occupied_block_size(block_address);
+
+    //      :      ,    
+    if (get_allocation_mode() != allocator_fit_allocation::allocation_mode::segregated_fit)
+    {
+        auto *current_block = get_first_available_block_address();
+        while (current_block != nullptr && current_block < adjacent_block_address)
+        {
+            current_block = get_available_block_next_available_block_address(current_block);
+        }
+
+        return current_block == adjacent_block_address
+            ? current_block
+            : nullptr;
+    }
+
+    return (get_block_flags(block_address) & _last_block_flag) == 0 && (get_block_flags(adjacent_block_address) & _block_available_flag) != 0
+        ? const_cast<unsigned char *>(adjacent_block_address)
+        : nullptr;
+}
+
+void allocator_sorted_list::rebuild_available_blocks(
+    allocator_fit_allocation::allocation_mode mode)
+{
+    auto const bins_requested = mode == allocator_fit_allocation::allocation_mode::segregated_fit;
+
+    if ((get_allocation_mode() == allocator_fit_allocation::allocation_mode::segregated_fit) == bins_requested)
+    {
+        return;
+    }
+
+    if (bins_requested)
+    {
+        //             ,   , 
+        //  ,     
+        if (get_smallest_block_size() < get_available_block_service_block_size(mode))
+        {
+            auto const error_message = "blocks are too small to switch to segregated_fit allocation mode";
+
+            this->error_with_guard(error_message);
+
+            throw std::logic_error(error_message);
+        }
+
+        std::vector<void *> available_blocks;
+        for (auto *current_block = get_first_available_block_address(); current_block != nullptr; current_block = get_available_block_next_available_block_address(current_block))
+        {
+            available_blocks.push_back(current_block);
+        }
+
+        *get_first_available_block_address_address() = nullptr;
+        rewrite_blocks_tags(available_blocks, true);
+
+        for (auto *available_block : available_blocks)
+        {
+            insert_available_block_into_bins(available_block);
+        }
+
+        return;
+    }
+
+    std::vector<void *> available_blocks;
+    for (size_t bin_index = 0; bin_index < _available_blocks_bins_count; ++bin_index)
+    {
+        auto ** const bin_first_block_address_address = get_available_blocks_bin_first_block_address_address(bin_index);
+
+        for (auto *current_block = *bin_first_block_address_address; current_block != nullptr; current_block = get_available_block_next_available_block_address(current_block))
+        {
+            available_blocks.push_back(current_block);
+        }
+
+        *bin_first_block_address_address = nullptr;
+    }
+    *get_available_blocks_bins_bitmap_address() = 0;
+
+    std::sort(available_blocks.begin(), available_blocks.end());
+    rewrite_blocks_tags(available_blocks, false);
+
+    void *next_block = nullptr;
+    for (auto iterator = available_blocks.rbegin(); iterator != available_blocks.rend(); ++iterator)
+    {
+        *reinterpret_cast<void **>(reinterpret_cast<size_t *>(*iterator) + 1) = next_block;
+        next_block = *iterator;
+    }
+
+    *get_first_available_block_address_address() = next_block;
+}
+
+size_t allocator_sorted_list::get_available_block_size(
+    void const *current_block_address) const
+{
+    return *reinterpret_cast<size_t const *>(current_block_address) & ~_block_flags_mask;
+}
+
+void *allocator_sorted_list::get_available_block_next_available_block_address(
+    void const *current_block_address) const
+{
+    return *reinterpret_cast<void * const *>(reinterpret_cast<size_t const *>(current_block_address) + 1);
+}
+
+size_t allocator_sorted_list::get_occupied_block_size(
+    void const *current_block_address) const
+{
+    return *reinterpret_cast<size_t const *>(current_block_address) & ~_block_flags_mask;
+}
+
+void allocator_sorted_list::dump_trusted_memory_blocks_state() const
+{
+    if (get_logger() == nullptr)
+    {
+        return;
+    }
+
+    std::vector<void *> available_blocks;
+    if (get_allocation_mode() == allocator_fit_allocation::allocation_mode::segregated_fit)
+    {
+        for (size_t bin_index = 0; bin_index < _available_blocks_bins_count; ++bin_index)
+        {
+            for (auto *current_block = *get_available_blocks_bin_first_block_address_address(bin_index); current_block != nullptr; current_block = get_available_block_next_available_block_address(current_block))
+            {
+                available_blocks.push_back(current_block);
+            }
+        }
+
+        std::sort(available_blocks.begin(), available_blocks.end());
+    }
+    else
+    {
+        for (auto *current_block = get_first_available_block_address(); current_block != nullptr; current_block = get_available_block_next_available_block_address(current_block))
+        {
+            available_blocks.push_back(current_block);
+        }
+    }
+
+    std::string to_dump("|");
+    auto memory_size = get_trusted_memory_size();
+    unsigned char *first_block = reinterpret_cast<unsigned char *>(_trusted_memory) + get_allocator_service_block_size();
+    auto *current_extra_segment = *get_first_extra_segment_address_address();
+
+    while (true)
+    {
+        //    ,         
+        auto current_available_block = std::lower_bound(available_blocks.begin(), available_blocks.end(), first_block);
+        unsigned char *current_block = first_block;
+
+        while (static_cast<size_t>(current_block - first_block) < memory_size)
+        {
+            size_t current_block_size;
+            if (current_available_block != available_blocks.end() && current_block == *current_available_block)
+            {
+                current_block_size = get_available_block_size(current_block);
+                to_dump += "avl ";
+                ++current_available_block;
+            }
+            else
+            {
+                current_block_size = get_occupied_block_size(current_block);
+                to_dump += "occ ";
+            }
+
+            to_dump += std::to_string(current_block_size) + "|";
+            current_block += current_block_size;
+        }
+
+        if (current_extra_segment == nullptr)
+        {
+            break;
+        }
+
+        memory_size = *reinterpret_cast<size_t *>(current_extra_segment);
+        first_block = reinterpret_cast<unsigned char *>(current_extra_segment) + get_extra_segment_service_block_size();
+        current_extra_segment = *reinterpret_cast<void **>(reinterpret_cast<size_t *>(current_extra_segment) + 1);
+        to_dump += "|";
+    }
+
+    this->debug_with_guard("Memory state: " + to_dump);
+}
+
+void *allocator_sorted_list::allocate(
+    size_t requested_block_size)
+{
+    if (get_default_alignment() != 1)
+    {
+        return allocate_aligned(requested_block_size, get_default_alignment());
+    }
+
+    //     :      
+    auto * const got_logger = get_logger();
+    if (got_logger != nullptr)
+    {
+        this->trace_with_guard("Method `void *" + get_typename() + "::allocate(size_t requested_block_size)` execution started")
+            ->debug_with_guard("Requested " + std::to_string(requested_block_size) + " bytes of memory");
+    }
+
+    auto requested_block_size_overridden = requested_block_size;
+    if (requested_block_size_overridden < get_occupied_block_minimal_data_size())
+    {
+        requested_block_size_overridden = get_occupied_block_minimal_data_size();
+    }
+
+    void *previous_block = nullptr, *current_block = get_first_available_block_address();
+    void *target_block = nullptr, *previous_to_target_block = nullptr, *next_to_target_block = nullptr;
+    auto const available_block_service_block_size = get_available_block_service_block_size();
+    auto const occupied_block_service_block_size = get_occupied_block_service_block_size();
+    auto const allocation_mode = get_allocation_mode();
+
+    //  next_fit       ,       
+    auto * const next_fit_rover = allocation_mode == allocator_fit_allocation::allocation_mode::next_fit
+        ? *get_next_fit_rover_address_address()
+        : nullptr;
+    auto search_wrapped = next_fit_rover == nullptr;
+
+    if (next_fit_rover != nullptr)
+    {
+        previous_block = next_fit_rover;
+        current_block = get_available_block_next_available_block_address(next_fit_rover);
+    }
+
+    if (allocation_mode == allocator_fit_allocation::allocation_mode::segregated_fit)
+    {
+        target_block = take_available_block_from_bins(requested_block_size_overridden + occupied_block_service_block_size);
+        current_block = nullptr;
+    }
+
+    while (current_block != nullptr || !search_wrapped)
+    {
+        if (current_block == nullptr)
+        {
+            previous_block = nullptr;
+            current_block = get_first_available_block_address();
+            search_wrapped = true;
+            continue;
+        }
+
+        auto const current_block_size = get_available_block_size(current_block);
+        auto const next_block = get_available_block_next_available_block_address(current_block);
+
+        if (current_block_size >= requested_block_size_overridden + occupied_block_service_block_size)
+        {
+            if (allocation_mode == allocator_fit_allocation::allocation_mode::first_fit ||
+                allocation_mode == allocator_fit_allocation::allocation_mode::next_fit ||
+                allocation_mode == allocator_fit_allocation::allocation_mode::the_best_fit && (target_block == nullptr || current_block_size < get_available_block_size(target_block)) ||
+                allocation_mode == allocator_fit_allocation::allocation_mode::the_worst_fit && (target_block == nullptr || current_block_size > get_available_block_size(target_block)))
+            {
+                previous_to_target_block = previous_block;
+                target_block = current_block;
+                next_to_target_block = next_block;
+            }
+
+            if (allocation_mode == allocator_fit_allocation::allocation_mode::first_fit ||
+                allocation_mode == allocator_fit_allocation::allocation_mode::next_fit)
+            {
+                break;
+            }
+        }
+
+        if (current_block == next_fit_rover)
+        {
+            break;
+        }
+
+        previous_block = current_block;
+        current_block = next_block;
+    }
+
+    if (target_block == nullptr && is_growable())
+    {
+        attach_extra_segment(requested_block_size_overridden + occupied_block_service_block_size);
+
+        if (got_logger != nullptr)
+        {
+            this->trace_with_guard("Method `void *" + get_typename() + "::allocate(size_t requested_block_size)` execution finished");
+        }
+
+        return allocate(requested_block_size);
+    }
+
+    if (target_block == nullptr)
+    {
+        auto const warning_message = "no memory available to allocate";
+
+        this->warning_with_guard(warning_message)
+            ->trace_with_guard("Method `void *" + get_typename() + "::allocate(size_t requested_block_size)` execution finished");
+
+        throw memory_exception(warning_message);
+    }
+
+    auto const target_block_size = get_available_block_size(target_block);
+    auto target_block_flags = get_block_flags(target_block) & (_previous_block_available_flag | _last_block_flag);
+
+    if (target_block_size - requested_block_size_overridden - occupied_block_service_block_size < available_block_service_block_size)
+    {
+        requested_block_size_overridden = target_block_size - occupied_block_service_block_size;
+    }
+
+    if (requested_block_size_overridden != requested_block_size)
+    {
+        if (got_logger != nullptr)
+        {
+            this->trace_with_guard("Requested " + std::to_string(requested_block_size) + " bytes, but reserved " + std::to_string(requested_block_size_overridden) + " bytes in according to correct work of allocator");
+        }
+
+        requested_block_size = requested_block_size_overridden;
+    }
+
+    if (allocation_mode == allocator_fit_allocation::allocation_mode::segregated_fit)
+    {
+        if (requested_block_size != target_block_size - occupied_block_service_block_size)
+        {
+            auto * const target_block_leftover_size = reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(target_block) + occupied_block_service_block_size + requested_block_size);
+            write_block_tags(target_block_leftover_size, target_block_size - occupied_block_service_block_size - requested_block_size, _block_available_flag | (target_block_flags & _last_block_flag));
+            target_block_flags &= ~_last_block_flag;
+
+            insert_available_block_into_bins(target_block_leftover_size);
+        }
+    }
+    else
+    {
+        void *updated_next_block_to_previous_block;
+
+        if (requested_block_size == target_block_size - occupied_block_service_block_size)
+        {
+            updated_next_block_to_previous_block = next_to_target_block;
+        }
+        else
+        {
+            updated_next_block_to_previous_block = reinterpret_cast<void *>(reinterpret_cast<unsigned char *>(target_block) + occupied_block_service_block_size + requested_block_size);
 
-    return memory_size_size + outer_allocator_pointer_size + logger_pointer_size + allocation_mode_size + first_available_block_pointer_size;
-}
+            auto * const target_block_leftover_size = reinterpret_cast<size_t *>(updated_next_block_to_previous_block);
+            *target_block_leftover_size = target_block_size - occupied_block_service_block_size - requested_block_size;
 
-size_t allocator_sorted_list::get_available_block_service_block_size() const noexcept
-{
-    auto const current_block_size = sizeof(size_t);
-    auto const next_available_block_pointer_size = sizeof(void *);
+            auto * const target_block_leftover_next_block_address = reinterpret_cast<void **>(target_block_leftover_size + 1);
+            *target_block_leftover_next_block_address = next_to_target_block;
+        }
 
-    return current_block_size + next_available_block_pointer_size;
-}
+        previous_to_target_block == nullptr
+            ? *get_first_available_block_address_address() = updated_next_block_to_previous_block
+            : *reinterpret_cast<void **>(reinterpret_cast<size_t *>(previous_to_target_block) + 1) = updated_next_block_to_previous_block;
 
-size_t allocator_sorted_list::get_occupied_block_service_block_size() const noexcept
-{
-    auto const current_block_size = sizeof(size_t);
+        //    next_fit      (    )
+        replace_next_fit_rover(target_block, previous_to_target_block);
 
-    return current_block_size;
-}
+        if (allocation_mode == allocator_fit_allocation::allocation_mode::next_fit)
+        {
+            *get_next_fit_rover_address_address() = previous_to_target_block;
+        }
+    }
 
-void **allocator_sorted_list::get_first_available_block_address_address() const noexcept
-{
-    return reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *) + sizeof(allocator_fit_allocation::allocation_mode));
-}
+    auto *target_block_size_address = reinterpret_cast<size_t *>(target_block);
+    write_block_tags(target_block_size_address, requested_block_size + sizeof(size_t), target_block_flags);
 
-void *allocator_sorted_list::get_first_available_block_address() const noexcept
-{
-    return *get_first_available_block_address_address();
-}
+    auto * const allocated_block = reinterpret_cast<void *>(target_block_size_address + 1);
 
-size_t allocator_sorted_list::get_available_block_size(
-    void const *current_block_address) const
-{
-    return *reinterpret_cast<size_t const *>(current_block_address);
-}
+    if (got_logger != nullptr)
+    {
+        this->trace_with_guard("Allocated block placed at " + address_to_hex(allocated_block))
+            ->trace_with_guard("Method `void *" + get_typename() + "::allocate(size_t requested_block_size)` execution finished");
 
-void *allocator_sorted_list::get_available_block_next_available_block_address(
-    void const *current_block_address) const
-{
-    return *reinterpret_cast<void * const *>(reinterpret_cast<size_t const *>(current_block_address) + 1);
+        this->debug_with_guard("After `allocate` for " + std::to_string(requested_block_size) + " bytes (addr == " +
+                                   address_to_hex(target_block_size_address) + "):");
+        dump_trusted_memory_blocks_state();
+    }
+
+    return allocated_block;
 }
 
-size_t allocator_sorted_list::get_occupied_block_size(
-    void const *current_block_address) const
+size_t allocator_sorted_list::get_natural_alignment() const noexcept
 {
-    return *reinterpret_cast<size_t const *>(current_block_address);
+    return get_default_alignment();
 }
 
-void allocator_sorted_list::dump_trusted_memory_blocks_state() const
+void *allocator_sorted_list::allocate_aligned(
+    size_t requested_block_size,
+    size_t alignment)
 {
-    if (get_logger() == nullptr)
+    //   allocate,      :  allocate_aligned       
+    auto * const got_logger = get_logger();
+    if (got_logger != nullptr)
     {
-        return;
+        this->trace_with_guard("Method `void *" + get_typename() + "::allocate_aligned(size_t requested_block_size, size_t alignment)` execution started")
+            ->debug_with_guard("Requested " + std::to_string(requested_block_size) + " bytes of memory aligned by " + std::to_string(alignment) + " bytes");
     }
 
-    std::string to_dump("|");
-    auto memory_size = get_trusted_memory_size();
-    auto current_available_block = get_first_available_block_address();
-    unsigned char *first_block = reinterpret_cast<unsigned char *>(_trusted_memory) + get_allocator_service_block_size();
-    unsigned char *current_block = first_block;
-
-    while (current_block - first_block < memory_size)
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
     {
-        size_t current_block_size;
-        if (current_block == current_available_block)
-        {
-            current_block_size = get_available_block_size(current_block);
-            to_dump += "avl ";
-            current_available_block = get_available_block_next_available_block_address(current_available_block);
-        }
-        else
-        {
-            current_block_size = get_occupied_block_size(current_block);
-            to_dump += "occ ";
-        }
-
-        to_dump += std::to_string(current_block_size) + "|";
-        current_block += current_block_size;
-    }
+        auto const error_message = "alignment should be a power of two";
 
-    this->debug_with_guard("Memory state: " + to_dump);
-}
+        this->error_with_guard(error_message)
+            ->trace_with_guard("Method `void *" + get_typename() + "::allocate_aligned(size_t requested_block_size, size_t alignment)` execution finished");
 
-void *allocator_sorted_list::allocate(
-    size_t requested_block_size)
-{
-    auto const got_typename = get_typename();
-    this->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution started")
-        ->debug_with_guard("Requested " + std::to_string(requested_block_size) + " bytes of memory");
+        throw std::invalid_argument(error_message);
+    }
 
-    auto requested_block_size_overridden = requested_block_size;
-    if (requested_block_size_overridden < sizeof(void *))
+    if (alignment < get_default_alignment())
     {
-        requested_block_size_overridden = sizeof(void *);
+        alignment = get_default_alignment();
     }
 
-    void *previous_block = nullptr, *current_block = get_first_available_block_address();
-    void *target_block = nullptr, *previous_to_target_block = nullptr, *next_to_target_block = nullptr;
     auto const available_block_service_block_size = get_available_block_service_block_size();
     auto const occupied_block_service_block_size = get_occupied_block_service_block_size();
+
+    //     ,   alignment    
+    if (alignment > (std::numeric_limits<size_t>::max() - occupied_block_service_block_size - available_block_service_block_size) / 2 ||
+        requested_block_size > std::numeric_limits<size_t>::max() - occupied_block_service_block_size - available_block_service_block_size - (alignment << 1))
+    {
+        auto const warning_message = "no memory available to allocate";
+
+        this->warning_with_guard(warning_message)
+            ->trace_with_guard("Method `void *" + get_typename() + "::allocate_aligned(size_t requested_block_size, size_t alignment)` execution finished");
+
+        throw memory_exception(warning_message);
+    }
+
     auto const allocation_mode = get_allocation_mode();
 
-    while (current_block != nullptr)
+    //   alignment,            
+    auto const required_block_size = ((requested_block_size < get_occupied_block_minimal_data_size() ? get_occupied_block_minimal_data_size() : requested_block_size) + occupied_block_service_block_size + alignment - 1) & ~(alignment - 1);
+
+    //  segregated_fit  ,   ,      
+    auto remaining_bins_bitmap = allocation_mode == allocator_fit_allocation::allocation_mode::segregated_fit
+        ? *get_available_blocks_bins_bitmap_address() & (~0ULL << get_requested_block_bin_index(required_block_size))
+        : 0ULL;
+    auto *current_block = allocation_mode == allocator_fit_allocation::allocation_mode::segregated_fit
+        ? nullptr
+        : get_first_available_block_address();
+    void *target_block = nullptr;
+    size_t target_block_offset = 0;
+
+    while (current_block != nullptr || remaining_bins_bitmap != 0)
     {
+        if (current_block == nullptr)
+        {
+            current_block = *get_available_blocks_bin_first_block_address_address(get_lowest_set_bit_index(remaining_bins_bitmap));
+            remaining_bins_bitmap &= remaining_bins_bitmap - 1;
+            continue;
+        }
+
         auto const current_block_size = get_available_block_size(current_block);
-        auto const next_block = get_available_block_next_available_block_address(current_block);
+        auto const current_block_offset = get_available_block_aligned_block_offset(current_block, alignment);
 
-        if (current_block_size >= requested_block_size_overridden + occupied_block_service_block_size)
+        if (current_block_offset + required_block_size <= current_block_size)
         {
             if (allocation_mode == allocator_fit_allocation::allocation_mode::first_fit ||
-                allocation_mode == allocator_fit_allocation::allocation_mode::the_best_fit && (target_block == nullptr || current_block_size < get_available_block_size(target_block)) ||
-                allocation_mode == allocator_fit_allocation::allocation_mode::the_worst_fit && (target_block == nullptr || current_block_size > get_available_block_size(target_block)))
+                allocation_mode == allocator_fit_allocation::allocation_mode::next_fit ||
+                allocation_mode == allocator_fit_allocation::allocation_mode::segregated_fit ||
+                (allocation_mode == allocator_fit_allocation::allocation_mode::the_best_fit && (target_block == nullptr || current_block_size < get_available_block_size(target_block))) ||
+                (allocation_mode == allocator_fit_allocation::allocation_mode::the_worst_fit && (target_block == nullptr || current_block_size > get_available_block_size(target_block))))
             {
-                previous_to_target_block = previous_block;
                 target_block = current_block;
-                next_to_target_block = next_block;
+                target_block_offset = current_block_offset;
             }
 
-            if (allocation_mode == allocator_fit_allocation::allocation_mode::first_fit)
+            if (allocation_mode == allocator_fit_allocation::allocation_mode::first_fit ||
+                allocation_mode == allocator_fit_allocation::allocation_mode::next_fit ||
+                allocation_mode == allocator_fit_allocation::allocation_mode::segregated_fit)
             {
                 break;
             }
         }
 
-        previous_block = current_block;
-        current_block = next_block;
+        current_block = get_available_block_next_available_block_address(current_block);
+    }
+
+    if (target_block == nullptr && is_growable())
+    {
+        //    alignment +     
+        attach_extra_segment(required_block_size + alignment + available_block_service_block_size);
+
+        if (got_logger != nullptr)
+        {
+            this->trace_with_guard("Method `void *" + get_typename() + "::allocate_aligned(size_t requested_block_size, size_t alignment)` execution finished");
+        }
+
+        return allocate_aligned(requested_block_size, alignment);
     }
 
     if (target_block == nullptr)
@@ -222,76 +1117,85 @@ void *allocator_sorted_list::allocate(
         auto const warning_message = "no memory available to allocate";
 
         this->warning_with_guard(warning_message)
-            ->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution finished");
+            ->trace_with_guard("Method `void *" + get_typename() + "::allocate_aligned(size_t requested_block_size, size_t alignment)` execution finished");
 
         throw memory_exception(warning_message);
     }
 
     auto const target_block_size = get_available_block_size(target_block);
+    auto block_flags = get_block_flags(target_block) & (_previous_block_available_flag | _last_block_flag);
 
-    if (target_block_size - requested_block_size_overridden - occupied_block_service_block_size < available_block_service_block_size)
-    {
-        requested_block_size_overridden = target_block_size - occupied_block_service_block_size;
-    }
+    allocation_mode == allocator_fit_allocation::allocation_mode::segregated_fit
+        ? remove_available_block_from_bins(target_block)
+        : remove_available_block_from_list(target_block);
 
-    if (requested_block_size_overridden != requested_block_size)
+    //          
+    if (target_block_offset != 0)
     {
-        this->trace_with_guard("Requested " + std::to_string(requested_block_size) + " bytes, but reserved " + std::to_string(requested_block_size_overridden) + " bytes in according to correct work of allocator");
+        write_block_tags(target_block, target_block_offset, _block_available_flag | (block_flags & _previous_block_available_flag));
+        block_flags |= _previous_block_available_flag;
 
-        requested_block_size = requested_block_size_overridden;
+        allocation_mode == allocator_fit_allocation::allocation_mode::segregated_fit
+            ? insert_available_block_into_bins(target_block)
+            : insert_available_block_into_list(target_block);
     }
 
-    void *updated_next_block_to_previous_block;
+    auto * const block_address = reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(target_block) + target_block_offset);
+    auto block_size = target_block_size - target_block_offset;
 
-    if (requested_block_size == target_block_size - occupied_block_service_block_size)
-    {
-        updated_next_block_to_previous_block = next_to_target_block;
-    }
-    else
+    if (block_size - required_block_size >= available_block_service_block_size)
     {
-        updated_next_block_to_previous_block = reinterpret_cast<void *>(reinterpret_cast<unsigned char *>(target_block) + occupied_block_service_block_size + requested_block_size);
-
-        auto * const target_block_leftover_size = reinterpret_cast<size_t *>(updated_next_block_to_previous_block);
-        *target_block_leftover_size = target_block_size - occupied_block_service_block_size - requested_block_size;
-
-        auto * const target_block_leftover_next_block_address = reinterpret_cast<void **>(target_block_leftover_size + 1);
-        *target_block_leftover_next_block_address = next_to_target_block;
+        auto * const block_leftover_size = reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(block_address) + required_block_size);
+        write_block_tags(block_leftover_size, block_size - required_block_size, _block_available_flag | (block_flags & _last_block_flag));
+        block_flags &= ~_last_block_flag;
+        block_size = required_block_size;
+
+        allocation_mode == allocator_fit_allocation::allocation_mode::segregated_fit
+            ? insert_available_block_into_bins(block_leftover_size)
+            : insert_available_block_into_list(block_leftover_size);
     }
 
-    previous_to_target_block == nullptr
-        ? *get_first_available_block_address_address() = updated_next_block_to_previous_block
-        : *reinterpret_cast<void **>(reinterpret_cast<size_t *>(previous_to_target_block) + 1) = updated_next_block_to_previous_block;
+    write_block_tags(block_address, block_size, block_flags);
 
-    auto *target_block_size_address = reinterpret_cast<size_t *>(target_block);
-    *target_block_size_address = requested_block_size + sizeof(size_t);
+    auto * const allocated_block = reinterpret_cast<void *>(block_address + 1);
 
-    auto * const allocated_block = reinterpret_cast<void *>(target_block_size_address + 1);
+    if (got_logger != nullptr)
+    {
+        this->trace_with_guard("Allocated block placed at " + address_to_hex(allocated_block))
+            ->trace_with_guard("Method `void *" + get_typename() + "::allocate_aligned(size_t requested_block_size, size_t alignment)` execution finished");
 
-    this->trace_with_guard("Allocated block placed at " + address_to_hex(allocated_block))
-        ->trace_with_guard("Method `void *" + got_typename + "::allocate(size_t requested_block_size)` execution finished");
+        this->debug_with_guard("After `allocate_aligned` for " + std::to_string(requested_block_size) + " bytes (addr == " +
+                                   address_to_hex(block_address) + "):");
+        dump_trusted_memory_blocks_state();
+    }
 
-    this->debug_with_guard("After `allocate` for " + std::to_string(requested_block_size) + " bytes (addr == " +
-                               address_to_hex(target_block_size_address) + "):");
-    dump_trusted_memory_blocks_state();
     return allocated_block;
 }
 
 void allocator_sorted_list::deallocate(
     void *block_to_deallocate_address)
 {
-    auto const got_typename = get_typename();
-    this->trace_with_guard(got_typename + "::deallocate(void *block_to_deallocate_address) execution started");
+    auto * const got_logger = get_logger();
+    if (got_logger != nullptr)
+    {
+        this->trace_with_guard(get_typename() + "::deallocate(void *block_to_deallocate_address) execution started");
+    }
 
     // TODO: check if memory was allocated from current allocator
     block_to_deallocate_address = reinterpret_cast<void *>(reinterpret_cast<size_t *>(block_to_deallocate_address) - 1);
 
     //    
-    dump_occupied_block_before_deallocate(block_to_deallocate_address, get_logger());
+    dump_occupied_block_before_deallocate(block_to_deallocate_address, got_logger);
 
     auto block_to_deallocate_size = get_occupied_block_size(block_to_deallocate_address); //   
     auto *current_available_block = get_first_available_block_address(); //  
+    auto *deallocated_block = block_to_deallocate_address; //    
 
-    if (current_available_block == nullptr)
+    if (get_allocation_mode() == allocator_fit_allocation::allocation_mode::segregated_fit)
+    {
+        deallocated_block = deallocate_into_bins(block_to_deallocate_address);
+    }
+    else if (current_available_block == nullptr)
     {
         *get_first_available_block_address_address() = block_to_deallocate_address;
 
@@ -315,6 +1219,7 @@ void allocator_sorted_list::deallocate(
             {
                 this->trace_with_guard("Merging previous available block with target block...");
                 *reinterpret_cast<size_t *>(previous_available_block) += block_to_deallocate_size;
+                deallocated_block = previous_available_block;
                 this->trace_with_guard("Merging completed");
             }
             else
@@ -331,6 +1236,7 @@ void allocator_sorted_list::deallocate(
                 this->trace_with_guard("Merging next available block with target block...");
                 block_to_deallocate_size = (*reinterpret_cast<size_t *>(block_to_deallocate_address) += get_available_block_size(current_available_block));
                 *reinterpret_cast<void **>(reinterpret_cast<size_t *>(block_to_deallocate_address) + 1) = get_available_block_next_available_block_address(current_available_block);
+                replace_next_fit_rover(current_available_block, block_to_deallocate_address);
                 this->trace_with_guard("Merging completed");
             }
             else
@@ -350,6 +1256,8 @@ void allocator_sorted_list::deallocate(
                     this->trace_with_guard("Merging previous available block with target block...");
                     *reinterpret_cast<size_t *>(previous_available_block) += block_to_deallocate_size;
                     *(reinterpret_cast<void **>(reinterpret_cast<size_t *>(previous_available_block) + 1)) = get_available_block_next_available_block_address(block_to_deallocate_address);
+                    replace_next_fit_rover(block_to_deallocate_address, previous_available_block);
+                    deallocated_block = previous_available_block;
                     this->trace_with_guard("Merging completed");
                 }
                 else
@@ -360,15 +1268,269 @@ void allocator_sorted_list::deallocate(
         }
     }
 
-    this->debug_with_guard("After `deallocate` (addr == " + address_to_hex(block_to_deallocate_address) + "):");
+    if (is_growable())
+    {
+        release_extra_segment_if_available(deallocated_block);
+    }
+
+    if (got_logger != nullptr)
+    {
+        this->debug_with_guard("After `deallocate` (addr == " + address_to_hex(block_to_deallocate_address) + "):");
+        dump_trusted_memory_blocks_state();
+        this->trace_with_guard(get_typename() + "::deallocate method execution finished");
+    }
+}
+
+void allocator_sorted_list::allocate_batch(
+    size_t blocks_count,
+    size_t requested_block_size,
+    void **allocated_blocks)
+{
+    //         first_fit;  ,      
+    if (get_allocation_mode() != allocator_fit_allocation::allocation_mode::first_fit || get_default_alignment() != 1)
+    {
+        allocator::allocate_batch(blocks_count, requested_block_size, allocated_blocks);
+        return;
+    }
+
+    auto const got_typename = get_typename();
+    this->trace_with_guard("Method `void " + got_typename + "::allocate_batch(size_t blocks_count, size_t requested_block_size, void **allocated_blocks)` execution started")
+        ->debug_with_guard("Requested " + std::to_string(blocks_count) + " blocks of " + std::to_string(requested_block_size) + " bytes of memory");
+
+    auto const available_block_service_block_size = get_available_block_service_block_size();
+    auto const required_block_size = (requested_block_size < get_occupied_block_minimal_data_size() ? get_occupied_block_minimal_data_size() : requested_block_size) + get_occupied_block_service_block_size();
+    size_t allocated_blocks_count = 0;
+
+    void *previous_block = nullptr, *current_block = get_first_available_block_address();
+
+    while (current_block != nullptr && allocated_blocks_count < blocks_count)
+    {
+        auto current_block_size = get_available_block_size(current_block);
+        auto * const next_block = get_available_block_next_available_block_address(current_block);
+
+        if (current_block_size < required_block_size)
+        {
+            previous_block = current_block;
+            current_block = next_block;
+            continue;
+        }
+
+        //      ,      
+        auto *block_address = reinterpret_cast<unsigned char *>(current_block);
+        while (allocated_blocks_count < blocks_count && current_block_size >= required_block_size)
+        {
+            auto const block_size = current_block_size - required_block_size < available_block_service_block_size
+                ? current_block_size
+                : required_block_size;
+
+            *reinterpret_cast<size_t *>(block_address) = block_size;
+            allocated_blocks[allocated_blocks_count++] = block_address + sizeof(size_t);
+
+            block_address += block_size;
+            current_block_size -= block_size;
+        }
+
+        void *updated_next_block_to_previous_block = next_block;
+        if (current_block_size != 0)
+        {
+            *reinterpret_cast<size_t *>(block_address) = current_block_size;
+            *reinterpret_cast<void **>(reinterpret_cast<size_t *>(block_address) + 1) = next_block;
+            updated_next_block_to_previous_block = block_address;
+        }
+
+        replace_next_fit_rover(current_block, current_block_size == 0
+            ? previous_block
+            : block_address);
+
+        previous_block == nullptr
+            ? *get_first_available_block_address_address() = updated_next_block_to_previous_block
+            : *reinterpret_cast<void **>(reinterpret_cast<size_t *>(previous_block) + 1) = updated_next_block_to_previous_block;
+
+        if (current_block_size != 0)
+        {
+            previous_block = block_address;
+        }
+
+        current_block = next_block;
+    }
+
+    if (allocated_blocks_count != blocks_count)
+    {
+        try
+        {
+            if (!is_growable())
+            {
+                throw memory_exception("no memory available to allocate");
+            }
+
+            attach_extra_segment((blocks_count - allocated_blocks_count) * required_block_size);
+            allocate_batch(blocks_count - allocated_blocks_count, requested_block_size, allocated_blocks + allocated_blocks_count);
+        }
+        catch (std::exception const &)
+        {
+            this->warning_with_guard("no memory available to allocate")
+                ->trace_with_guard("Method `void " + got_typename + "::allocate_batch(size_t blocks_count, size_t requested_block_size, void **allocated_blocks)` execution finished");
+
+            deallocate_batch(allocated_blocks, allocated_blocks_count);
+            throw;
+        }
+    }
+
+    this->trace_with_guard("Method `void " + got_typename + "::allocate_batch(size_t blocks_count, size_t requested_block_size, void **allocated_blocks)` execution finished");
+
+    this->debug_with_guard("After `allocate_batch` for " + std::to_string(blocks_count) + " blocks of " + std::to_string(requested_block_size) + " bytes:");
+    dump_trusted_memory_blocks_state();
+}
+
+void allocator_sorted_list::deallocate_batch(
+    void **blocks_to_deallocate,
+    size_t blocks_count)
+{
+    if (get_allocation_mode() == allocator_fit_allocation::allocation_mode::segregated_fit)
+    {
+        allocator::deallocate_batch(blocks_to_deallocate, blocks_count);
+        return;
+    }
+
+    auto const got_typename = get_typename();
+    this->trace_with_guard("Method `void " + got_typename + "::deallocate_batch(void **blocks_to_deallocate, size_t blocks_count)` execution started");
+
+    std::vector<void *> blocks;
+    blocks.reserve(blocks_count);
+    for (size_t i = 0; i < blocks_count; ++i)
+    {
+        blocks.push_back(reinterpret_cast<size_t *>(blocks_to_deallocate[i]) - 1);
+    }
+
+    std::sort(blocks.begin(), blocks.end());
+
+    //          
+    void *previous_available_block = nullptr, *current_available_block = get_first_available_block_address();
+
+    // ,     ;   ,      
+    std::vector<void *> updated_available_blocks;
+
+    for (auto *block_address : blocks)
+    {
+        while (current_available_block != nullptr && current_available_block < block_address)
+        {
+            previous_available_block = current_available_block;
+            current_available_block = get_available_block_next_available_block_address(current_available_block);
+        }
+
+        if (previous_available_block != nullptr && reinterpret_cast<unsigned char *>(previous_available_block) + get_available_block_size(previous_available_block) == block_address)
+        {
+            *reinterpret_cast<size_t *>(previous_available_block) += get_occupied_block_size(block_address);
+        }
+        else
+        {
+            *reinterpret_cast<void **>(reinterpret_cast<size_t *>(block_address) + 1) = current_available_block;
+
+            previous_available_block == nullptr
+                ? *get_first_available_block_address_address() = block_address
+                : *reinterpret_cast<void **>(reinterpret_cast<size_t *>(previous_available_block) + 1) = block_address;
+
+            previous_available_block = block_address;
+        }
+
+        if (current_available_block != nullptr && reinterpret_cast<unsigned char *>(previous_available_block) + get_available_block_size(previous_available_block) == current_available_block)
+        {
+            *reinterpret_cast<size_t *>(previous_available_block) += get_available_block_size(current_available_block);
+            replace_next_fit_rover(current_available_block, previous_available_block);
+            current_available_block = get_available_block_next_available_block_address(current_available_block);
+            *reinterpret_cast<void **>(reinterpret_cast<size_t *>(previous_available_block) + 1) = current_available_block;
+        }
+
+        if (updated_available_blocks.empty() || updated_available_blocks.back() != previous_available_block)
+        {
+            updated_available_blocks.push_back(previous_available_block);
+        }
+    }
+
+    if (is_growable())
+    {
+        //    ,         
+        void *previous_segment = nullptr, *current_segment = *get_first_extra_segment_address_address();
+
+        while (current_segment != nullptr)
+        {
+            auto * const next_segment = *reinterpret_cast<void **>(reinterpret_cast<size_t *>(current_segment) + 1);
+            void * const segment_first_block = reinterpret_cast<unsigned char *>(current_segment) + get_extra_segment_service_block_size();
+
+            if (std::binary_search(updated_available_blocks.begin(), updated_available_blocks.end(), segment_first_block)
+                && get_available_block_size(segment_first_block) == *reinterpret_cast<size_t *>(current_segment))
+            {
+                release_extra_segment(previous_segment, current_segment);
+            }
+            else
+            {
+                previous_segment = current_segment;
+            }
+
+            current_segment = next_segment;
+        }
+    }
+
+    this->debug_with_guard("After `deallocate_batch` for " + std::to_string(blocks_count) + " blocks:");
     dump_trusted_memory_blocks_state();
-    this->trace_with_guard(got_typename + "::deallocate method execution finished");
+    this->trace_with_guard("Method `void " + got_typename + "::deallocate_batch(void **blocks_to_deallocate, size_t blocks_count)` execution finished");
 }
 
 void *allocator_sorted_list::reallocate(
     void *block_to_reallocate_address,
     size_t new_block_size)
 {
+    auto const got_typename = get_typename();
+    this->trace_with_guard("Method `void *" + got_typename + "::reallocate(void *block_to_reallocate_address, size_t new_block_size)` execution started");
+
+    auto * const block_address = reinterpret_cast<size_t *>(block_to_reallocate_address) - 1;
+    auto const required_block_size = (new_block_size < get_occupied_block_minimal_data_size() ? get_occupied_block_minimal_data_size() : new_block_size) + get_occupied_block_service_block_size();
+    auto * const adjacent_available_block = get_adjacent_available_block_address(block_address);
+    auto const in_place_block_size = get_occupied_block_size(block_address) + (adjacent_available_block == nullptr
+        ? 0
+        : get_available_block_size(adjacent_available_block));
+
+    //              
+    if (required_block_size <= in_place_block_size)
+    {
+        auto const allocation_mode = get_allocation_mode();
+        auto block_flags = get_block_flags(block_address) & (_previous_block_available_flag | _last_block_flag);
+        auto block_size = in_place_block_size;
+
+        if (adjacent_available_block != nullptr)
+        {
+            this->trace_with_guard("Merging next available block with target block...");
+            allocation_mode == allocator_fit_allocation::allocation_mode::segregated_fit
+                ? remove_available_block_from_bins(adjacent_available_block)
+                : remove_available_block_from_list(adjacent_available_block);
+            block_flags = (block_flags & _previous_block_available_flag) | (get_block_flags(adjacent_available_block) & _last_block_flag);
+            this->trace_with_guard("Merging completed");
+        }
+
+        if (in_place_block_size - required_block_size >= get_available_block_service_block_size())
+        {
+            auto * const block_leftover_size = reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(block_address) + required_block_size);
+            write_block_tags(block_leftover_size, in_place_block_size - required_block_size, _block_available_flag | (block_flags & _last_block_flag));
+            block_flags &= ~_last_block_flag;
+            block_size = required_block_size;
+
+            allocation_mode == allocator_fit_allocation::allocation_mode::segregated_fit
+                ? insert_available_block_into_bins(block_leftover_size)
+                : insert_available_block_into_list(block_leftover_size);
+        }
+
+        write_block_tags(block_address, block_size, block_flags);
+
+        this->trace_with_guard("Block reallocated in place at " + address_to_hex(block_to_reallocate_address))
+            ->trace_with_guard("Method `void *" + got_typename + "::reallocate(void *block_to_reallocate_address, size_t new_block_size)` execution finished");
+
+        this->debug_with_guard("After `reallocate` for " + std::to_string(new_block_size) + " bytes (addr == " + address_to_hex(block_address) + "):");
+        dump_trusted_memory_blocks_state();
+        return block_to_reallocate_address;
+    }
+
+    this->trace_with_guard("Method `void *" + got_typename + "::reallocate(void *block_to_reallocate_address, size_t new_block_size)` execution finished");
+
     auto * new_block = allocate(new_block_size);
     auto occupied_block_service_block_size = get_occupied_block_service_block_size();
     auto data_to_move_size = std::min(get_occupied_block_size(reinterpret_cast<unsigned char const *>(new_block) - occupied_block_service_block_size), get_occupied_block_size(reinterpret_cast<unsigned char const *>(block_to_reallocate_address) - occupied_block_service_block_size)) - occupied_block_service_block_size;
@@ -395,9 +1557,28 @@ bool allocator_sorted_list::reallocate(
 void allocator_sorted_list::setup_allocation_mode(
         allocator_fit_allocation::allocation_mode mode)
 {
+    rebuild_available_blocks(mode);
+
+    *get_next_fit_rover_address_address() = nullptr;
+
     *reinterpret_cast<allocator_fit_allocation::allocation_mode *>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *)) = mode;
 }
 
+void allocator_sorted_list::setup_default_alignment(
+    size_t alignment)
+{
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+    {
+        auto const error_message = "alignment should be a power of two";
+
+        this->error_with_guard(error_message);
+
+        throw std::invalid_argument(error_message);
+    }
+
+    *(reinterpret_cast<size_t *>(get_first_extra_segment_address_address() + 1) + 1) = alignment;
+}
+
 logger *allocator_sorted_list::get_logger() const noexcept
 {
     return *reinterpret_cast<logger **>(reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1) + 1);
@@ -1,6 +1,7 @@
 #ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_SORTED_LIST_DEALLOCATION_H
 #define DATA_STRUCTURES_CPP_MEMORY_WITH_SORTED_LIST_DEALLOCATION_H
 
+#include <vector>
 #include "typename_holder.h"
 #include "logger.h"
 #include "logger_holder.h"
@@ -15,6 +16,24 @@ class allocator_sorted_list final:
     protected allocator_holder
 {
 
+private:
+
+    //      segregated_fit (       ).
+    static constexpr size_t _available_blocks_bins_count = 64;
+
+    //      ( 8 ),     .
+    static constexpr size_t _available_blocks_small_bins_count = 32;
+
+    //    ,    segregated_fit       :
+    // ,      (     ),      .
+    static constexpr size_t _block_available_flag = static_cast<size_t>(1) << (sizeof(size_t) * 8 - 1);
+
+    static constexpr size_t _previous_block_available_flag = _block_available_flag >> 1;
+
+    static constexpr size_t _last_block_flag = _block_available_flag >> 2;
+
+    static constexpr size_t _block_flags_mask = _block_available_flag | _previous_block_available_flag | _last_block_flag;
+
 private:
 
     void *_trusted_memory;
@@ -22,11 +41,13 @@ private:
 public:
     //      ,    , 
     //    ( ),    .
+    // growable == true,         ( )  .
     explicit allocator_sorted_list(
         size_t memory_size,
         allocator *outer_allocator = nullptr,
         logger *logger = nullptr,
-        allocator_fit_allocation::allocation_mode allocation_mode = allocator_fit_allocation::allocation_mode::first_fit);
+        allocator_fit_allocation::allocation_mode allocation_mode = allocator_fit_allocation::allocation_mode::first_fit,
+        bool growable = false);
 
     allocator_sorted_list(
         allocator_sorted_list const &other) = delete;
@@ -51,15 +72,134 @@ private:
     //       .
     [[nodiscard]] size_t get_available_block_service_block_size() const noexcept override;
 
+    //         allocation_mode:   segregated_fit
+    //            .
+    [[nodiscard]] static size_t get_available_block_service_block_size(
+        allocator_fit_allocation::allocation_mode allocation_mode) noexcept;
+
     //       .
     [[nodiscard]] size_t get_occupied_block_service_block_size() const noexcept override;
 
+    //     :        .
+    [[nodiscard]] size_t get_occupied_block_minimal_data_size() const noexcept;
+
+    //   ,     block_address ( ,  segregated_fit, - 0).
+    [[nodiscard]] static size_t get_block_flags(
+        void const *block_address) noexcept;
+
+    //   block_address   block_flags;   segregated_fit     
+    //          .      .
+    void write_block_tags(
+        void *block_address,
+        size_t block_size,
+        size_t block_flags) const noexcept;
+
+    // (tagged == true)             ;
+    //available_blocks -     .
+    void rewrite_blocks_tags(
+        std::vector<void *> const &available_blocks,
+        bool tagged) const;
+
+    //    (  )    .
+    [[nodiscard]] size_t get_smallest_block_size() const noexcept;
+
     //       .
     [[nodiscard]] void **get_first_available_block_address_address() const noexcept override;
 
     //     .
     [[nodiscard]] void *get_first_available_block_address() const noexcept override;
 
+    //       .
+    [[nodiscard]] unsigned long long *get_available_blocks_bins_bitmap_address() const noexcept;
+
+    //          bin_index.
+    [[nodiscard]] void **get_available_blocks_bin_first_block_address_address(
+        size_t bin_index) const noexcept;
+
+    //        .
+    [[nodiscard]] void **get_first_extra_segment_address_address() const noexcept;
+
+    // true,       .
+    [[nodiscard]] bool is_growable() const noexcept;
+
+    // ,   allocate   (1,    ).
+    [[nodiscard]] size_t get_default_alignment() const noexcept;
+
+    //    next_fit:  ,     (nullptr -    ).
+    [[nodiscard]] void **get_next_fit_rover_address_address() const noexcept;
+
+    //   next_fit   block_address,     ,   replacement_block_address.
+    void replace_next_fit_rover(
+        void const *block_address,
+        void *replacement_block_address) const noexcept;
+
+    //     ,        alignment,
+    //    (  )     .
+    [[nodiscard]] size_t get_available_block_aligned_block_offset(
+        void const *block_address,
+        size_t alignment) const noexcept;
+
+    //       .
+    [[nodiscard]] size_t get_extra_segment_service_block_size() const noexcept;
+
+    //  ,    required_block_size,       .
+    void attach_extra_segment(
+        size_t required_block_size);
+
+    //    ,    available_block_address   .
+    void release_extra_segment_if_available(
+        void *available_block_address);
+
+    //   segment,      previous_segment,        .
+    void release_extra_segment(
+        void *previous_segment,
+        void *segment);
+
+    //         .
+    void insert_available_block_into_list(
+        void *block_address);
+
+    //         .
+    void remove_available_block_from_list(
+        void *block_address);
+
+    //  ,       block_size.
+    [[nodiscard]] static size_t get_available_block_bin_index(
+        size_t block_size) noexcept;
+
+    //  ,       block_size.
+    [[nodiscard]] static size_t get_requested_block_bin_index(
+        size_t block_size) noexcept;
+
+    //       ,     block_address.
+    [[nodiscard]] static void **get_available_block_previous_available_block_address_address(
+        void *block_address) noexcept;
+
+    //        .
+    void insert_available_block_into_bins(
+        void *block_address);
+
+    //       .
+    void remove_available_block_from_bins(
+        void *block_address);
+
+    //         required_block_size (nullptr,   ).
+    [[nodiscard]] void *take_available_block_from_bins(
+        size_t required_block_size);
+
+    //  ,       block_address (nullptr,   ).
+    [[nodiscard]] void *get_adjacent_available_block_address(
+        void const *block_address) const;
+
+    //    segregated_fit,      ;    .
+    void *deallocate_into_bins(
+        void *block_to_deallocate_address);
+
+    //           ;
+    // std::logic_error,  ,    ,     segregated_fit.
+    void rebuild_available_blocks(
+        allocator_fit_allocation::allocation_mode mode);
+
     //      current_block_address.
     size_t get_available_block_size(
         void const *current_block_address) const override;
@@ -81,10 +221,32 @@ public:
     void *allocate(
         size_t requested_block_size) override;
 
+    using allocator::deallocate;
+
     //      block_to_deallocate_address.
     void deallocate(
         void *block_to_deallocate_address) override;
 
+    // ,  allocate   :    ,      .
+    [[nodiscard]] size_t get_natural_alignment() const noexcept override;
+
+    //    requested_block_size,     alignment ( ).
+    [[nodiscard]] void *allocate_aligned(
+        size_t requested_block_size,
+        size_t alignment) override;
+
+    // blocks_count   requested_block_size       ,   
+    //    ,      allocated_blocks.
+    void allocate_batch(
+        size_t blocks_count,
+        size_t requested_block_size,
+        void **allocated_blocks) override;
+
+    // blocks_count :  ,          .
+    void deallocate_batch(
+        void **blocks_to_deallocate,
+        size_t blocks_count) override;
+
     //  ,     new_block_size.  ,     .
     [[nodiscard]] void *reallocate(
         void *block_to_reallocate_address,
@@ -101,6 +263,10 @@ public:
     void setup_allocation_mode(
         allocator_fit_allocation::allocation_mode mode) override;
 
+    //  ( ),   allocate   ; , 16  SSE-.
+    void setup_default_alignment(
+        size_t alignment);
+
 private:
     
     //    logger,    .
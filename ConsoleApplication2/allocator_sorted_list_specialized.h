@@ -0,0 +1,500 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_SORTED_LIST_SPECIALIZED_H
+#define DATA_STRUCTURES_CPP_MEMORY_WITH_SORTED_LIST_SPECIALIZED_H
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include "typename_holder.h"
+#include "logger.h"
+#include "logger_holder.h"
+#include "allocator.h"
+#include "allocator_holder.h"
+
+//   " ":        .
+struct first_fit_policy final
+{
+
+    static constexpr bool stops_at_first_suitable_block = true;
+
+    [[nodiscard]] static constexpr bool is_preferred(
+        [[maybe_unused]] size_t candidate_block_size,
+        [[maybe_unused]] size_t target_block_size) noexcept
+    {
+        return false;
+    }
+
+    [[nodiscard]] static char const *get_name() noexcept
+    {
+        return "first_fit_policy";
+    }
+
+};
+
+//   " ":     .
+struct the_best_fit_policy final
+{
+
+    static constexpr bool stops_at_first_suitable_block = false;
+
+    [[nodiscard]] static constexpr bool is_preferred(
+        size_t candidate_block_size,
+        size_t target_block_size) noexcept
+    {
+        return candidate_block_size < target_block_size;
+    }
+
+    [[nodiscard]] static char const *get_name() noexcept
+    {
+        return "the_best_fit_policy";
+    }
+
+};
+
+//   " ":     .
+struct the_worst_fit_policy final
+{
+
+    static constexpr bool stops_at_first_suitable_block = false;
+
+    [[nodiscard]] static constexpr bool is_preferred(
+        size_t candidate_block_size,
+        size_t target_block_size) noexcept
+    {
+        return candidate_block_size > target_block_size;
+    }
+
+    [[nodiscard]] static char const *get_name() noexcept
+    {
+        return "the_worst_fit_policy";
+    }
+
+};
+
+//   allocator_sorted_list:   (size_t),      -     .
+struct size_t_block_header_layout final
+{
+
+    static constexpr size_t occupied_block_service_block_size = sizeof(size_t);
+
+    static constexpr size_t available_block_service_block_size = sizeof(size_t) + sizeof(void *);
+
+    static constexpr size_t block_alignment = alignof(size_t);
+
+    static constexpr size_t max_memory_size = std::numeric_limits<size_t>::max();
+
+    [[nodiscard]] static size_t get_block_size(
+        void const *block_address) noexcept
+    {
+        return *reinterpret_cast<size_t const *>(block_address);
+    }
+
+    static void set_block_size(
+        void *block_address,
+        size_t block_size) noexcept
+    {
+        *reinterpret_cast<size_t *>(block_address) = block_size;
+    }
+
+    [[nodiscard]] static void *get_next_available_block_address(
+        void const *block_address,
+        [[maybe_unused]] unsigned char *memory_base_address) noexcept
+    {
+        return *reinterpret_cast<void * const *>(reinterpret_cast<size_t const *>(block_address) + 1);
+    }
+
+    static void set_next_available_block_address(
+        void *block_address,
+        void *next_block_address,
+        [[maybe_unused]] unsigned char *memory_base_address) noexcept
+    {
+        *reinterpret_cast<void **>(reinterpret_cast<size_t *>(block_address) + 1) = next_block_address;
+    }
+
+    [[nodiscard]] static char const *get_name() noexcept
+    {
+        return "size_t_block_header_layout";
+    }
+
+};
+
+//   : 32-  ,      - 32-  
+//      (0 -   ).    4 ,    4 .
+//  ,   :        ,   size_t_block_header_layout.
+struct compact_block_header_layout final
+{
+
+    static constexpr size_t occupied_block_service_block_size = sizeof(uint32_t);
+
+    static constexpr size_t available_block_service_block_size = sizeof(uint32_t) + sizeof(uint32_t);
+
+    static constexpr size_t block_alignment = alignof(uint32_t);
+
+    static constexpr size_t max_memory_size = std::numeric_limits<uint32_t>::max();
+
+    [[nodiscard]] static size_t get_block_size(
+        void const *block_address) noexcept
+    {
+        return *reinterpret_cast<uint32_t const *>(block_address);
+    }
+
+    static void set_block_size(
+        void *block_address,
+        size_t block_size) noexcept
+    {
+        *reinterpret_cast<uint32_t *>(block_address) = static_cast<uint32_t>(block_size);
+    }
+
+    [[nodiscard]] static void *get_next_available_block_address(
+        void const *block_address,
+        unsigned char *memory_base_address) noexcept
+    {
+        auto const next_block_offset = reinterpret_cast<uint32_t const *>(block_address)[1];
+
+        return next_block_offset == 0
+            ? nullptr
+            : memory_base_address + next_block_offset;
+    }
+
+    static void set_next_available_block_address(
+        void *block_address,
+        void *next_block_address,
+        unsigned char *memory_base_address) noexcept
+    {
+        reinterpret_cast<uint32_t *>(block_address)[1] = next_block_address == nullptr
+            ? 0
+            : static_cast<uint32_t>(reinterpret_cast<unsigned char *>(next_block_address) - memory_base_address);
+    }
+
+    [[nodiscard]] static char const *get_name() noexcept
+    {
+        return "compact_block_header_layout";
+    }
+
+};
+
+// allocator_sorted_list,           .
+//            ;  
+//  allocator.    header_layout::block_alignment.
+template<
+    typename fit_policy,
+    typename header_layout>
+class allocator_sorted_list_specialized final:
+    public allocator,
+    protected logger_holder,
+    protected typename_holder,
+    protected allocator_holder
+{
+
+private:
+
+    void *_trusted_memory;
+
+public:
+
+    //      memory_size (     ).
+    explicit allocator_sorted_list_specialized(
+        size_t memory_size,
+        allocator *outer_allocator = nullptr,
+        logger *log = nullptr)
+    {
+        auto got_typename = get_typename();
+
+        if (log != nullptr)
+        {
+            log->trace(got_typename + " allocator instance construction started")
+                ->debug("requested memory size: " + std::to_string(memory_size) + " bytes");
+        }
+
+        memory_size &= ~(header_layout::block_alignment - 1);
+
+        auto const minimal_trusted_memory_size = header_layout::available_block_service_block_size;
+        auto const maximal_trusted_memory_size = header_layout::max_memory_size - get_allocator_service_block_size() - header_layout::block_alignment;
+
+        if (memory_size < minimal_trusted_memory_size || memory_size > maximal_trusted_memory_size)
+        {
+            auto error_message = "trusted memory size should be GT " + std::to_string(minimal_trusted_memory_size) + " bytes and LT " + std::to_string(maximal_trusted_memory_size) + " bytes";
+
+            if (log != nullptr)
+            {
+                log->error(error_message);
+            }
+
+            throw allocator::memory_exception(error_message);
+        }
+
+        //  ,        
+        auto const trusted_memory_size = get_allocator_service_block_size() + header_layout::block_alignment - 1 + memory_size;
+
+        _trusted_memory = outer_allocator == nullptr
+            ? ::operator new(trusted_memory_size)
+            : outer_allocator->allocate(trusted_memory_size);
+
+        auto * const memory_size_space = reinterpret_cast<size_t *>(_trusted_memory);
+        *memory_size_space = memory_size;
+
+        auto * const outer_allocator_pointer_space = reinterpret_cast<allocator **>(memory_size_space + 1);
+        *outer_allocator_pointer_space = outer_allocator;
+
+        auto * const logger_pointer_space = reinterpret_cast<logger **>(outer_allocator_pointer_space + 1);
+        *logger_pointer_space = log;
+
+        auto * const first_available_block = get_first_block_address();
+        header_layout::set_block_size(first_available_block, memory_size);
+        header_layout::set_next_available_block_address(first_available_block, nullptr, get_memory_base_address());
+
+        *get_first_available_block_address_address() = first_available_block;
+
+        this->trace_with_guard(got_typename + " allocator instance construction finished");
+    }
+
+    allocator_sorted_list_specialized(
+        allocator_sorted_list_specialized const &other) = delete;
+
+    allocator_sorted_list_specialized &operator=(
+        allocator_sorted_list_specialized const &other) = delete;
+
+    // .  ,     .
+    ~allocator_sorted_list_specialized() noexcept
+    {
+        auto got_typename = get_typename();
+        this->trace_with_guard(got_typename + " allocator instance destruction started");
+
+        auto const * const logger = get_logger();
+
+        deallocate_with_guard(_trusted_memory);
+
+        if (logger != nullptr)
+        {
+            logger->trace(got_typename + " allocator instance destruction finished");
+        }
+    }
+
+private:
+
+    //     .
+    [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override
+    {
+        auto const memory_size_size = sizeof(size_t);
+        auto const outer_allocator_pointer_size = sizeof(allocator *);
+        auto const logger_pointer_size = sizeof(logger *);
+        auto const first_available_block_pointer_size = sizeof(void *);
+
+        return memory_size_size + outer_allocator_pointer_size + logger_pointer_size + first_available_block_pointer_size;
+    }
+
+    //    ,       .
+    [[nodiscard]] unsigned char *get_memory_base_address() const noexcept
+    {
+        return reinterpret_cast<unsigned char *>(_trusted_memory);
+    }
+
+    //      .
+    [[nodiscard]] void **get_first_available_block_address_address() const noexcept override
+    {
+        return reinterpret_cast<void **>(get_memory_base_address() + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *));
+    }
+
+    //      .
+    [[nodiscard]] void *get_first_block_address() const noexcept
+    {
+        auto const first_block_address = reinterpret_cast<uintptr_t>(get_memory_base_address() + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *) + sizeof(void *));
+
+        return reinterpret_cast<void *>((first_block_address + header_layout::block_alignment - 1) & ~static_cast<uintptr_t>(header_layout::block_alignment - 1));
+    }
+
+    //   (  ),   requested_block_size .
+    [[nodiscard]] static size_t get_required_block_size(
+        size_t requested_block_size) noexcept
+    {
+        auto const required_block_size = requested_block_size + header_layout::occupied_block_service_block_size < header_layout::available_block_service_block_size
+            ? header_layout::available_block_service_block_size
+            : requested_block_size + header_layout::occupied_block_service_block_size;
+
+        return (required_block_size + header_layout::block_alignment - 1) & ~(header_layout::block_alignment - 1);
+    }
+
+public:
+
+    //  ,   .
+    [[nodiscard]] size_t get_natural_alignment() const noexcept override
+    {
+        return header_layout::block_alignment;
+    }
+
+    //    requested_block_size,     fit_policy.
+    [[nodiscard]] void *allocate(
+        size_t requested_block_size) override
+    {
+        if (requested_block_size > *reinterpret_cast<size_t *>(_trusted_memory))
+        {
+            auto const warning_message = "no memory available to allocate";
+
+            this->warning_with_guard(warning_message);
+
+            throw memory_exception(warning_message);
+        }
+
+        auto * const memory_base_address = get_memory_base_address();
+        auto const required_block_size = get_required_block_size(requested_block_size);
+
+        void *previous_block = nullptr, *current_block = *get_first_available_block_address_address();
+        void *target_block = nullptr, *previous_to_target_block = nullptr;
+        size_t target_block_size = 0;
+
+        while (current_block != nullptr)
+        {
+            auto const current_block_size = header_layout::get_block_size(current_block);
+
+            if (current_block_size >= required_block_size && (target_block == nullptr || fit_policy::is_preferred(current_block_size, target_block_size)))
+            {
+                previous_to_target_block = previous_block;
+                target_block = current_block;
+                target_block_size = current_block_size;
+
+                if constexpr (fit_policy::stops_at_first_suitable_block)
+                {
+                    break;
+                }
+            }
+
+            previous_block = current_block;
+            current_block = header_layout::get_next_available_block_address(current_block, memory_base_address);
+        }
+
+        if (target_block == nullptr)
+        {
+            auto const warning_message = "no memory available to allocate";
+
+            this->warning_with_guard(warning_message);
+
+            throw memory_exception(warning_message);
+        }
+
+        auto *next_to_target_block = header_layout::get_next_available_block_address(target_block, memory_base_address);
+
+        if (target_block_size - required_block_size >= header_layout::available_block_service_block_size)
+        {
+            auto * const target_block_leftover = reinterpret_cast<unsigned char *>(target_block) + required_block_size;
+            header_layout::set_block_size(target_block_leftover, target_block_size - required_block_size);
+            header_layout::set_next_available_block_address(target_block_leftover, next_to_target_block, memory_base_address);
+
+            next_to_target_block = target_block_leftover;
+            header_layout::set_block_size(target_block, required_block_size);
+        }
+
+        if (previous_to_target_block == nullptr)
+        {
+            *get_first_available_block_address_address() = next_to_target_block;
+        }
+        else
+        {
+            header_layout::set_next_available_block_address(previous_to_target_block, next_to_target_block, memory_base_address);
+        }
+
+        return reinterpret_cast<unsigned char *>(target_block) + header_layout::occupied_block_service_block_size;
+    }
+
+    using allocator::deallocate;
+
+    //     block_to_deallocate_address,      .
+    void deallocate(
+        void *block_to_deallocate_address) override
+    {
+        auto * const memory_base_address = get_memory_base_address();
+        auto * const block_address = reinterpret_cast<unsigned char *>(block_to_deallocate_address) - header_layout::occupied_block_service_block_size;
+        auto block_size = header_layout::get_block_size(block_address);
+
+        void *previous_block = nullptr, *next_block = *get_first_available_block_address_address();
+        while (next_block != nullptr && next_block < block_address)
+        {
+            previous_block = next_block;
+            next_block = header_layout::get_next_available_block_address(next_block, memory_base_address);
+        }
+
+        if (next_block == block_address + block_size)
+        {
+            block_size += header_layout::get_block_size(next_block);
+            header_layout::set_block_size(block_address, block_size);
+            next_block = header_layout::get_next_available_block_address(next_block, memory_base_address);
+        }
+
+        if (previous_block != nullptr && reinterpret_cast<unsigned char *>(previous_block) + header_layout::get_block_size(previous_block) == block_address)
+        {
+            header_layout::set_block_size(previous_block, header_layout::get_block_size(previous_block) + block_size);
+            header_layout::set_next_available_block_address(previous_block, next_block, memory_base_address);
+            return;
+        }
+
+        header_layout::set_next_available_block_address(block_address, next_block, memory_base_address);
+
+        if (previous_block == nullptr)
+        {
+            *get_first_available_block_address_address() = block_address;
+        }
+        else
+        {
+            header_layout::set_next_available_block_address(previous_block, block_address, memory_base_address);
+        }
+    }
+
+    //  ,     new_block_size.      ,   .
+    [[nodiscard]] void *reallocate(
+        void *block_to_reallocate_address,
+        size_t new_block_size) override
+    {
+        auto const block_size = header_layout::get_block_size(reinterpret_cast<unsigned char *>(block_to_reallocate_address) - header_layout::occupied_block_service_block_size);
+
+        if (new_block_size <= block_size - header_layout::occupied_block_service_block_size)
+        {
+            return block_to_reallocate_address;
+        }
+
+        auto * new_block = allocate(new_block_size);
+        memcpy(new_block, block_to_reallocate_address, block_size - header_layout::occupied_block_service_block_size);
+        deallocate(block_to_reallocate_address);
+        return new_block;
+    }
+
+    //      .    ,    .
+    bool reallocate(
+        void **block_to_reallocate_address_address,
+        size_t new_block_size) override
+    {
+        try {
+            *block_to_reallocate_address_address = reallocate(*block_to_reallocate_address_address, new_block_size);
+            return true;
+        }
+        catch (std::exception const &ex)
+        {
+            this->warning_with_guard(ex.what());
+            return false;
+        }
+    }
+
+private:
+
+    //    logger,    .
+    [[nodiscard]] logger *get_logger() const noexcept override
+    {
+        return *reinterpret_cast<logger **>(reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1) + 1);
+    }
+
+private:
+
+    //       .
+    [[nodiscard]] std::string get_typename() const noexcept override
+    {
+        return std::string("allocator_sorted_list_specialized<") + fit_policy::get_name() + ", " + header_layout::get_name() + ">";
+    }
+
+private:
+
+    //     (  ).
+    [[nodiscard]] allocator *get_allocator() const noexcept override
+    {
+        return *reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1);
+    }
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_WITH_SORTED_LIST_SPECIALIZED_H
\ No newline at end of file
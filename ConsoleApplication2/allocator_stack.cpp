@@ -0,0 +1,270 @@
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include "allocator_stack.h"
+
+allocator_stack::scope_guard::scope_guard(
+    allocator_stack &allocator):
+    _allocator(allocator),
+    _marker(allocator.get_marker())
+{
+
+}
+
+allocator_stack::scope_guard::~scope_guard() noexcept
+{
+    _allocator.rollback(_marker);
+}
+
+allocator_stack::allocator_stack(
+    size_t memory_size,
+    allocator *outer_allocator,
+    logger *log,
+    bool checked)
+{
+    auto got_typename = get_typename();
+
+    if (log != nullptr)
+    {
+        log->trace(got_typename + " allocator instance construction started")
+            ->debug("requested memory size: " + std::to_string(memory_size) + " bytes");
+    }
+
+    auto const minimal_trusted_memory_size = get_occupied_block_service_block_size() + _block_alignment;
+
+    if (memory_size < minimal_trusted_memory_size)
+    {
+        auto error_message = "trusted memory size should be GT " + std::to_string(minimal_trusted_memory_size) + " bytes";
+
+        if (log != nullptr)
+        {
+            log->error(error_message);
+        }
+
+        throw allocator::memory_exception(error_message);
+    }
+
+    auto const allocator_service_block_size = get_allocator_service_block_size();
+
+    _trusted_memory = outer_allocator == nullptr
+        ? ::operator new(memory_size + allocator_service_block_size)
+        : outer_allocator->allocate(memory_size + allocator_service_block_size);
+
+    auto * const memory_size_space = reinterpret_cast<size_t *>(_trusted_memory);
+    *memory_size_space = memory_size;
+
+    auto * const outer_allocator_pointer_space = reinterpret_cast<allocator **>(memory_size_space + 1);
+    *outer_allocator_pointer_space = outer_allocator;
+
+    auto * const logger_pointer_space = reinterpret_cast<logger **>(outer_allocator_pointer_space + 1);
+    *logger_pointer_space = log;
+
+    auto * const checked_space = reinterpret_cast<size_t *>(logger_pointer_space + 1);
+    *checked_space = checked;
+
+    auto * const top_pointer_space = reinterpret_cast<void **>(checked_space + 1);
+    *top_pointer_space = get_bottom_address();
+
+    auto * const last_block_pointer_space = top_pointer_space + 1;
+    *last_block_pointer_space = nullptr;
+
+    this->trace_with_guard(got_typename + " allocator instance construction finished");
+}
+
+allocator_stack::~allocator_stack() noexcept
+{
+    auto got_typename = get_typename();
+    this->trace_with_guard(got_typename + " allocator instance destruction started");
+
+    auto const * const logger = get_logger();
+
+    deallocate_with_guard(_trusted_memory);
+
+    if (logger != nullptr)
+    {
+        logger->trace(got_typename + " allocator instance destruction finished");
+    }
+}
+
+size_t allocator_stack::get_trusted_memory_size() const noexcept
+{
+    return *reinterpret_cast<size_t *>(_trusted_memory);
+}
+
+size_t allocator_stack::get_allocator_service_block_size() const noexcept
+{
+    auto const memory_size_size = sizeof(size_t);
+    auto const outer_allocator_pointer_size = sizeof(allocator *);
+    auto const logger_pointer_size = sizeof(logger *);
+    auto const checked_size = sizeof(size_t);
+    auto const top_pointer_size = sizeof(void *);
+    auto const last_block_pointer_size = sizeof(void *);
+
+    return memory_size_size + outer_allocator_pointer_size + logger_pointer_size + checked_size + top_pointer_size + last_block_pointer_size;
+}
+
+size_t allocator_stack::get_occupied_block_service_block_size() const noexcept
+{
+    auto const previous_block_pointer_size = sizeof(void *);
+    auto const block_size_size = sizeof(size_t);
+
+    return (previous_block_pointer_size + block_size_size + _block_alignment - 1) & ~(_block_alignment - 1);
+}
+
+size_t allocator_stack::get_occupied_block_size(
+    void const *current_block_address) const
+{
+    return *(reinterpret_cast<size_t const *>(current_block_address) + 1);
+}
+
+void **allocator_stack::get_top_address_address() const noexcept
+{
+    return reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(size_t) + sizeof(allocator *) + sizeof(logger *) + sizeof(size_t));
+}
+
+void **allocator_stack::get_last_block_address_address() const noexcept
+{
+    return get_top_address_address() + 1;
+}
+
+bool allocator_stack::is_checked() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1) + 1) + 1) != 0;
+}
+
+unsigned char *allocator_stack::get_bottom_address() const noexcept
+{
+    auto const memory_begin = reinterpret_cast<size_t>(_trusted_memory) + get_allocator_service_block_size();
+
+    //    ,      
+    return reinterpret_cast<unsigned char *>((memory_begin + _block_alignment - 1) & ~(_block_alignment - 1));
+}
+
+unsigned char *allocator_stack::get_end_address() const noexcept
+{
+    return reinterpret_cast<unsigned char *>(_trusted_memory) + get_allocator_service_block_size() + get_trusted_memory_size();
+}
+
+void **allocator_stack::get_occupied_block_previous_occupied_block_address_address(
+    void *current_block_address) noexcept
+{
+    return reinterpret_cast<void **>(current_block_address);
+}
+
+void *allocator_stack::allocate(
+    size_t requested_block_size)
+{
+    auto const block_capacity = (requested_block_size + _block_alignment - 1) & ~(_block_alignment - 1);
+    auto * const block = reinterpret_cast<unsigned char *>(*get_top_address_address());
+
+    //,   ,   ,       
+    if (requested_block_size > std::numeric_limits<size_t>::max() - get_occupied_block_service_block_size() - _block_alignment
+        || static_cast<size_t>(get_end_address() - block) < get_occupied_block_service_block_size() + block_capacity)
+    {
+        auto const warning_message = "no memory available to allocate";
+
+        this->warning_with_guard(warning_message);
+
+        throw memory_exception(warning_message);
+    }
+
+    *get_occupied_block_previous_occupied_block_address_address(block) = *get_last_block_address_address();
+    *(reinterpret_cast<size_t *>(block) + 1) = block_capacity;
+
+    *get_last_block_address_address() = block;
+    *get_top_address_address() = block + get_occupied_block_service_block_size() + block_capacity;
+
+    return block + get_occupied_block_service_block_size();
+}
+
+void allocator_stack::deallocate(
+    void *block_to_deallocate_address)
+{
+    auto * const block = reinterpret_cast<unsigned char *>(block_to_deallocate_address) - get_occupied_block_service_block_size();
+
+    if (is_checked() && block != *get_last_block_address_address())
+    {
+        auto const error_message = "block at " + address_to_hex(block_to_deallocate_address) + " is not the last allocated block";
+
+        this->error_with_guard(error_message);
+
+        throw std::logic_error(error_message);
+    }
+
+    *get_last_block_address_address() = *get_occupied_block_previous_occupied_block_address_address(block);
+    *get_top_address_address() = block;
+}
+
+void *allocator_stack::reallocate(
+    void *block_to_reallocate_address,
+    size_t new_block_size)
+{
+    auto * const block = reinterpret_cast<unsigned char *>(block_to_reallocate_address) - get_occupied_block_service_block_size();
+    auto const block_capacity = get_occupied_block_size(block);
+
+    if (block == *get_last_block_address_address() && new_block_size <= std::numeric_limits<size_t>::max() - _block_alignment)
+    {
+        auto const new_block_capacity = (new_block_size + _block_alignment - 1) & ~(_block_alignment - 1);
+
+        if (static_cast<size_t>(get_end_address() - reinterpret_cast<unsigned char *>(block_to_reallocate_address)) >= new_block_capacity)
+        {
+            *(reinterpret_cast<size_t *>(block) + 1) = new_block_capacity;
+            *get_top_address_address() = reinterpret_cast<unsigned char *>(block_to_reallocate_address) + new_block_capacity;
+
+            return block_to_reallocate_address;
+        }
+    }
+
+    //          ,      
+    auto * new_block = allocate(new_block_size);
+    memcpy(new_block, block_to_reallocate_address, std::min(block_capacity, new_block_size));
+    return new_block;
+}
+
+bool allocator_stack::reallocate(
+    void **block_to_reallocate_address_address,
+    size_t new_block_size)
+{
+    try {
+        *block_to_reallocate_address_address = reallocate(*block_to_reallocate_address_address, new_block_size);
+        return true;
+    }
+    catch (std::exception const &ex)
+    {
+        this->warning_with_guard(ex.what());
+        return false;
+    }
+}
+
+allocator_stack::marker allocator_stack::get_marker() const noexcept
+{
+    marker current;
+
+    current._top = *get_top_address_address();
+    current._last_block = *get_last_block_address_address();
+
+    return current;
+}
+
+void allocator_stack::rollback(
+    marker const &to) noexcept
+{
+    *get_top_address_address() = to._top;
+    *get_last_block_address_address() = to._last_block;
+}
+
+logger *allocator_stack::get_logger() const noexcept
+{
+    return *reinterpret_cast<logger **>(reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1) + 1);
+}
+
+std::string allocator_stack::get_typename() const noexcept
+{
+    return "allocator_stack";
+}
+
+allocator *allocator_stack::get_allocator() const noexcept
+{
+    return *reinterpret_cast<allocator **>(reinterpret_cast<size_t *>(_trusted_memory) + 1);
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_STACK_H
+#define DATA_STRUCTURES_CPP_MEMORY_WITH_STACK_H
+
+#include "typename_holder.h"
+#include "logger.h"
+#include "logger_holder.h"
+#include "allocator.h"
+#include "allocator_holder.h"
+
+class allocator_stack final:
+    public allocator,
+    protected logger_holder,
+    protected typename_holder,
+    protected allocator_holder
+{
+
+private:
+
+    //  .
+    static constexpr size_t _block_alignment = 16;
+
+public:
+
+    // ,      rollback.
+    class marker final
+    {
+
+        friend class allocator_stack;
+
+    private:
+
+        void *_top;
+
+        void *_last_block;
+
+    };
+
+    //            .
+    class scope_guard final
+    {
+
+    private:
+
+        allocator_stack &_allocator;
+
+        marker _marker;
+
+    public:
+
+        explicit scope_guard(
+            allocator_stack &allocator);
+
+        scope_guard(
+            scope_guard const &other) = delete;
+
+        scope_guard &operator=(
+            scope_guard const &other) = delete;
+
+        ~scope_guard() noexcept;
+
+    };
+
+private:
+
+    void *_trusted_memory;
+
+public:
+
+    //   memory_size  .   checked       .
+    explicit allocator_stack(
+        size_t memory_size,
+        allocator *outer_allocator = nullptr,
+        logger *logger = nullptr,
+        bool checked = false);
+
+    allocator_stack(
+        allocator_stack const &other) = delete;
+
+    allocator_stack &operator=(
+        allocator_stack const &other) = delete;
+
+    // .        
+    ~allocator_stack() noexcept;
+
+private:
+
+    //     
+    [[nodiscard]] size_t get_trusted_memory_size() const noexcept override;
+
+    //     .
+    [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override;
+
+    //        (   ,   ).
+    [[nodiscard]] size_t get_occupied_block_service_block_size() const noexcept override;
+
+    //      current_block_address (  ).
+    size_t get_occupied_block_size(
+        void const *current_block_address) const override;
+
+    //     .
+    [[nodiscard]] void **get_top_address_address() const noexcept;
+
+    //      .
+    [[nodiscard]] void **get_last_block_address_address() const noexcept;
+
+    // true,     .
+    [[nodiscard]] bool is_checked() const noexcept;
+
+    //    (  ).
+    [[nodiscard]] unsigned char *get_bottom_address() const noexcept;
+
+    //   .
+    [[nodiscard]] unsigned char *get_end_address() const noexcept;
+
+    //    ,    current_block_address (  ).
+    [[nodiscard]] static void **get_occupied_block_previous_occupied_block_address_address(
+        void *current_block_address) noexcept;
+
+public:
+
+    //    requested_block_size   .
+    void *allocate(
+        size_t requested_block_size) override;
+
+    using allocator::deallocate;
+
+    //    block_to_deallocate_address    ,   .
+    void deallocate(
+        void *block_to_deallocate_address) override;
+
+    //  ,     new_block_size.      .
+    [[nodiscard]] void *reallocate(
+        void *block_to_reallocate_address,
+        size_t new_block_size) override;
+
+    //      .    ,    .
+    bool reallocate(
+        void **block_to_reallocate_address_address,
+        size_t new_block_size) override;
+
+public:
+
+    //    .
+    [[nodiscard]] marker get_marker() const noexcept;
+
+    //  ,     to.
+    void rollback(
+        marker const &to) noexcept;
+
+private:
+
+    //    logger,    .
+    [[nodiscard]] logger *get_logger() const noexcept override;
+
+private:
+
+    //     (allocator_stack).
+    [[nodiscard]] std::string get_typename() const noexcept override;
+
+private:
+
+    //     (  ).
+    [[nodiscard]] allocator *get_allocator() const noexcept override;
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_WITH_STACK_H
\ No newline at end of file
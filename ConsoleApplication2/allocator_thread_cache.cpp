@@ -0,0 +1,466 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <vector>
+#include "allocator_thread_cache.h"
+
+struct allocator_thread_cache::thread_cache
+{
+    //,   ;    
+    std::atomic<allocator_thread_cache *> owner;
+
+    //      owner
+    thread_cache *next;
+
+    //     ,      
+    void *available_blocks[_size_classes_count];
+
+    size_t available_blocks_counts[_size_classes_count];
+};
+
+struct allocator_thread_cache::thread_caches_holder
+{
+    std::vector<thread_cache *> caches;
+
+    ~thread_caches_holder() noexcept;
+};
+
+namespace
+{
+
+    //,         allocator_thread_cache.
+    std::mutex &get_thread_caches_registry_mutex()
+    {
+        static std::mutex registry_mutex;
+        return registry_mutex;
+    }
+
+}
+
+allocator_thread_cache::thread_caches_holder::~thread_caches_holder() noexcept
+{
+    std::lock_guard<std::mutex> registry_lock(get_thread_caches_registry_mutex());
+
+    for (auto *cache : caches)
+    {
+        auto *owner = cache->owner.load(std::memory_order_relaxed);
+
+        if (owner != nullptr)
+        {
+            for (size_t size_class_index = 0; size_class_index < _size_classes_count; size_class_index++)
+            {
+                owner->drain_thread_cache(cache, size_class_index, cache->available_blocks_counts[size_class_index]);
+            }
+
+            auto **cache_address_address = owner->get_first_thread_cache_address_address();
+            while (*cache_address_address != cache)
+            {
+                cache_address_address = &(*cache_address_address)->next;
+            }
+
+            *cache_address_address = cache->next;
+        }
+
+        delete cache;
+    }
+}
+
+allocator_thread_cache::allocator_thread_cache(
+    allocator *backing_allocator,
+    logger *log,
+    size_t high_water_mark,
+    size_t batch_size)
+{
+    auto got_typename = get_typename();
+
+    if (log != nullptr)
+    {
+        log->trace(got_typename + " allocator instance construction started")
+            ->debug("high water mark: " + std::to_string(high_water_mark) + " blocks, batch size: " + std::to_string(batch_size) + " blocks");
+    }
+
+    if (batch_size == 0 || batch_size > high_water_mark)
+    {
+        auto error_message = "batch size should be GT 0 and LE high water mark";
+
+        if (log != nullptr)
+        {
+            log->error(error_message);
+        }
+
+        throw std::invalid_argument(error_message);
+    }
+
+    auto const allocator_service_block_size = get_allocator_service_block_size();
+
+    _trusted_memory = backing_allocator == nullptr
+        ? ::operator new(allocator_service_block_size)
+        : backing_allocator->allocate(allocator_service_block_size);
+
+    auto * const backing_allocator_pointer_space = reinterpret_cast<allocator **>(_trusted_memory);
+    *backing_allocator_pointer_space = backing_allocator;
+
+    auto * const logger_pointer_space = reinterpret_cast<logger **>(backing_allocator_pointer_space + 1);
+    *logger_pointer_space = log;
+
+    auto * const high_water_mark_space = reinterpret_cast<size_t *>(logger_pointer_space + 1);
+    *high_water_mark_space = high_water_mark;
+
+    auto * const batch_size_space = high_water_mark_space + 1;
+    *batch_size_space = batch_size;
+
+    auto * const first_thread_cache_pointer_space = reinterpret_cast<thread_cache **>(batch_size_space + 1);
+    *first_thread_cache_pointer_space = nullptr;
+
+    new (&get_backing_allocator_mutex()) std::mutex();
+
+    this->trace_with_guard(got_typename + " allocator instance construction finished");
+}
+
+allocator_thread_cache::~allocator_thread_cache() noexcept
+{
+    auto got_typename = get_typename();
+    this->trace_with_guard(got_typename + " allocator instance destruction started");
+
+    auto const * const logger = get_logger();
+
+    {
+        std::lock_guard<std::mutex> registry_lock(get_thread_caches_registry_mutex());
+
+        //          
+        for (auto *cache = *get_first_thread_cache_address_address(); cache != nullptr; cache = cache->next)
+        {
+            for (size_t size_class_index = 0; size_class_index < _size_classes_count; size_class_index++)
+            {
+                drain_thread_cache(cache, size_class_index, cache->available_blocks_counts[size_class_index]);
+            }
+
+            cache->owner.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    get_backing_allocator_mutex().~mutex();
+
+    deallocate_with_guard(_trusted_memory);
+
+    if (logger != nullptr)
+    {
+        logger->trace(got_typename + " allocator instance destruction finished");
+    }
+}
+
+size_t allocator_thread_cache::get_allocator_service_block_size() const noexcept
+{
+    auto const backing_allocator_pointer_size = sizeof(allocator *);
+    auto const logger_pointer_size = sizeof(logger *);
+    auto const high_water_mark_size = sizeof(size_t);
+    auto const batch_size_size = sizeof(size_t);
+    auto const first_thread_cache_pointer_size = sizeof(thread_cache *);
+    auto const backing_allocator_mutex_alignment_size = alignof(std::mutex) - 1;
+    auto const backing_allocator_mutex_size = sizeof(std::mutex);
+
+    return backing_allocator_pointer_size + logger_pointer_size + high_water_mark_size + batch_size_size + first_thread_cache_pointer_size + backing_allocator_mutex_alignment_size + backing_allocator_mutex_size;
+}
+
+size_t allocator_thread_cache::get_occupied_block_service_block_size() const noexcept
+{
+    auto const block_capacity_size = sizeof(size_t);
+
+    return block_capacity_size;
+}
+
+size_t allocator_thread_cache::get_occupied_block_size(
+    void const *current_block_address) const
+{
+    return *reinterpret_cast<size_t const *>(current_block_address);
+}
+
+size_t allocator_thread_cache::get_high_water_mark() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1) + 1);
+}
+
+size_t allocator_thread_cache::get_batch_size() const noexcept
+{
+    return *(reinterpret_cast<size_t *>(reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1) + 1) + 1);
+}
+
+allocator_thread_cache::thread_cache **allocator_thread_cache::get_first_thread_cache_address_address() const noexcept
+{
+    return reinterpret_cast<thread_cache **>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(allocator *) + sizeof(logger *) + sizeof(size_t) + sizeof(size_t));
+}
+
+std::mutex &allocator_thread_cache::get_backing_allocator_mutex() const noexcept
+{
+    //         ,     
+    auto const backing_allocator_mutex_address = reinterpret_cast<uintptr_t>(get_first_thread_cache_address_address() + 1);
+
+    return *reinterpret_cast<std::mutex *>((backing_allocator_mutex_address + alignof(std::mutex) - 1) & ~(alignof(std::mutex) - 1));
+}
+
+allocator_thread_cache::thread_cache *allocator_thread_cache::get_current_thread_cache()
+{
+    static thread_local thread_caches_holder holder;
+
+    for (auto *cache : holder.caches)
+    {
+        if (cache->owner.load(std::memory_order_relaxed) == this)
+        {
+            return cache;
+        }
+    }
+
+    this->trace_with_guard("Creating thread cache for " + get_typename() + " at " + address_to_hex(this));
+
+    std::lock_guard<std::mutex> registry_lock(get_thread_caches_registry_mutex());
+
+    //       ,  
+    holder.caches.erase(std::remove_if(holder.caches.begin(), holder.caches.end(), [](thread_cache *cache)
+    {
+        if (cache->owner.load(std::memory_order_relaxed) != nullptr)
+        {
+            return false;
+        }
+
+        delete cache;
+        return true;
+    }), holder.caches.end());
+
+    auto *cache = new thread_cache;
+    cache->owner.store(this, std::memory_order_relaxed);
+    std::fill(cache->available_blocks, cache->available_blocks + _size_classes_count, nullptr);
+    std::fill(cache->available_blocks_counts, cache->available_blocks_counts + _size_classes_count, 0);
+
+    auto **first_thread_cache_address_address = get_first_thread_cache_address_address();
+    cache->next = *first_thread_cache_address_address;
+    *first_thread_cache_address_address = cache;
+
+    holder.caches.push_back(cache);
+
+    return cache;
+}
+
+void allocator_thread_cache::refill_thread_cache(
+    thread_cache *cache,
+    size_t size_class_index)
+{
+    auto const block_capacity = (size_class_index + 1) * _size_class_granularity;
+    auto const batch_size = get_batch_size();
+    size_t refilled_blocks_count = 0;
+
+    {
+        std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+
+        try
+        {
+            for (; refilled_blocks_count < batch_size; refilled_blocks_count++)
+            {
+                auto *block = reinterpret_cast<size_t *>(allocate_with_guard(get_occupied_block_service_block_size() + block_capacity));
+                *block = block_capacity;
+
+                *reinterpret_cast<void **>(block + 1) = cache->available_blocks[size_class_index];
+                cache->available_blocks[size_class_index] = block + 1;
+            }
+        }
+        catch (std::exception const &)
+        {
+            //  :    
+        }
+
+        cache->available_blocks_counts[size_class_index] += refilled_blocks_count;
+    }
+
+    this->trace_with_guard("Refilled thread cache with " + std::to_string(refilled_blocks_count) + " blocks of " + std::to_string(block_capacity) + " bytes");
+}
+
+void allocator_thread_cache::drain_thread_cache(
+    thread_cache *cache,
+    size_t size_class_index,
+    size_t blocks_count)
+{
+    if (blocks_count == 0)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+
+        for (size_t i = 0; i < blocks_count; i++)
+        {
+            auto *block = cache->available_blocks[size_class_index];
+            cache->available_blocks[size_class_index] = *reinterpret_cast<void **>(block);
+
+            deallocate_with_guard(reinterpret_cast<size_t *>(block) - 1);
+        }
+
+        cache->available_blocks_counts[size_class_index] -= blocks_count;
+    }
+
+    this->trace_with_guard("Drained " + std::to_string(blocks_count) + " blocks of " + std::to_string((size_class_index + 1) * _size_class_granularity) + " bytes from thread cache");
+}
+
+size_t allocator_thread_cache::get_natural_alignment() const noexcept
+{
+    return std::min(get_natural_alignment_with_guard(), alignof(size_t));
+}
+
+void *allocator_thread_cache::allocate(
+    size_t requested_block_size)
+{
+    auto const size_class_index = requested_block_size == 0
+        ? 0
+        : (requested_block_size - 1) / _size_class_granularity;
+
+    if (size_class_index >= _size_classes_count)
+    {
+        if (requested_block_size > std::numeric_limits<size_t>::max() - get_occupied_block_service_block_size())
+        {
+            auto const warning_message = "no memory available to allocate";
+
+            this->warning_with_guard(warning_message);
+
+            throw memory_exception(warning_message);
+        }
+
+        size_t *block;
+
+        {
+            std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+            block = reinterpret_cast<size_t *>(allocate_with_guard(get_occupied_block_service_block_size() + requested_block_size));
+        }
+
+        *block = requested_block_size;
+        return block + 1;
+    }
+
+    auto *cache = get_current_thread_cache();
+
+    if (cache->available_blocks[size_class_index] == nullptr)
+    {
+        refill_thread_cache(cache, size_class_index);
+
+        if (cache->available_blocks[size_class_index] == nullptr)
+        {
+            auto const warning_message = "no memory available to allocate";
+
+            this->warning_with_guard(warning_message);
+
+            throw memory_exception(warning_message);
+        }
+    }
+
+    auto *allocated_block = cache->available_blocks[size_class_index];
+    cache->available_blocks[size_class_index] = *reinterpret_cast<void **>(allocated_block);
+    cache->available_blocks_counts[size_class_index]--;
+
+    return allocated_block;
+}
+
+void allocator_thread_cache::deallocate(
+    void *block_to_deallocate_address)
+{
+    auto const block_capacity = get_occupied_block_size(reinterpret_cast<size_t *>(block_to_deallocate_address) - 1);
+
+    if (block_capacity > _size_classes_count * _size_class_granularity)
+    {
+        std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+        deallocate_with_guard(reinterpret_cast<size_t *>(block_to_deallocate_address) - 1);
+        return;
+    }
+
+    deallocate_into_thread_cache(block_to_deallocate_address, block_capacity / _size_class_granularity - 1);
+}
+
+void allocator_thread_cache::deallocate(
+    void *block_to_deallocate_address,
+    size_t block_size)
+{
+    auto const size_class_index = block_size == 0
+        ? 0
+        : (block_size - 1) / _size_class_granularity;
+
+#ifdef _DEBUG
+    //      :     ,    
+    auto const block_capacity = get_occupied_block_size(reinterpret_cast<size_t *>(block_to_deallocate_address) - 1);
+    if (size_class_index >= _size_classes_count
+        ? block_capacity != block_size
+        : block_capacity != (size_class_index + 1) * _size_class_granularity)
+    {
+        auto const error_message = "deallocated block size " + std::to_string(block_size) + " bytes does not match allocated block capacity " + std::to_string(block_capacity) + " bytes";
+
+        this->error_with_guard(error_message);
+
+        throw std::invalid_argument(error_message);
+    }
+#endif
+
+    if (size_class_index >= _size_classes_count)
+    {
+        std::lock_guard<std::mutex> backing_allocator_lock(get_backing_allocator_mutex());
+        deallocate_with_guard(reinterpret_cast<size_t *>(block_to_deallocate_address) - 1);
+        return;
+    }
+
+    deallocate_into_thread_cache(block_to_deallocate_address, size_class_index);
+}
+
+void allocator_thread_cache::deallocate_into_thread_cache(
+    void *block_to_deallocate_address,
+    size_t size_class_index)
+{
+    auto *cache = get_current_thread_cache();
+
+    *reinterpret_cast<void **>(block_to_deallocate_address) = cache->available_blocks[size_class_index];
+    cache->available_blocks[size_class_index] = block_to_deallocate_address;
+
+    if (++cache->available_blocks_counts[size_class_index] > get_high_water_mark())
+    {
+        drain_thread_cache(cache, size_class_index, get_batch_size());
+    }
+}
+
+void *allocator_thread_cache::reallocate(
+    void *block_to_reallocate_address,
+    size_t new_block_size)
+{
+    auto * new_block = allocate(new_block_size);
+    auto data_to_move_size = std::min(get_occupied_block_size(reinterpret_cast<size_t const *>(new_block) - 1), get_occupied_block_size(reinterpret_cast<size_t const *>(block_to_reallocate_address) - 1));
+    memcpy(new_block, block_to_reallocate_address, data_to_move_size);
+    deallocate(block_to_reallocate_address);
+    return new_block;
+}
+
+bool allocator_thread_cache::reallocate(
+    void **block_to_reallocate_address_address,
+    size_t new_block_size)
+{
+    try {
+        *block_to_reallocate_address_address = reallocate(*block_to_reallocate_address_address, new_block_size);
+        return true;
+    }
+    catch (std::exception const &ex)
+    {
+        this->warning_with_guard(ex.what());
+        return false;
+    }
+}
+
+logger *allocator_thread_cache::get_logger() const noexcept
+{
+    return *reinterpret_cast<logger **>(reinterpret_cast<allocator **>(_trusted_memory) + 1);
+}
+
+std::string allocator_thread_cache::get_typename() const noexcept
+{
+    return "allocator_thread_cache";
+}
+
+allocator *allocator_thread_cache::get_allocator() const noexcept
+{
+    return *reinterpret_cast<allocator **>(_trusted_memory);
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#ifndef DATA_STRUCTURES_CPP_MEMORY_WITH_THREAD_CACHE_H
+#define DATA_STRUCTURES_CPP_MEMORY_WITH_THREAD_CACHE_H
+
+#include <mutex>
+#include "typename_holder.h"
+#include "logger.h"
+#include "logger_holder.h"
+#include "allocator.h"
+#include "allocator_holder.h"
+
+class allocator_thread_cache final:
+    public allocator,
+    protected logger_holder,
+    protected typename_holder,
+    protected allocator_holder
+{
+
+private:
+
+    //     ( ).
+    static constexpr size_t _size_class_granularity = 16;
+
+    //  ;        .
+    static constexpr size_t _size_classes_count = 32;
+
+    //      allocator_thread_cache (  allocator_thread_cache.cpp).
+    struct thread_cache;
+
+    //   ,       .
+    struct thread_caches_holder;
+
+private:
+
+    void *_trusted_memory;
+
+public:
+
+    //    backing_allocator.     high_water_mark  
+    //  ,       batch_size .
+    explicit allocator_thread_cache(
+        allocator *backing_allocator,
+        logger *logger = nullptr,
+        size_t high_water_mark = 64,
+        size_t batch_size = 32);
+
+    allocator_thread_cache(
+        allocator_thread_cache const &other) = delete;
+
+    allocator_thread_cache &operator=(
+        allocator_thread_cache const &other) = delete;
+
+    // .            .
+    ~allocator_thread_cache() noexcept;
+
+private:
+
+    //     .
+    [[nodiscard]] size_t get_allocator_service_block_size() const noexcept override;
+
+    //        ( ).
+    [[nodiscard]] size_t get_occupied_block_service_block_size() const noexcept override;
+
+    //      current_block_address (   ).
+    size_t get_occupied_block_size(
+        void const *current_block_address) const override;
+
+    //         .
+    [[nodiscard]] size_t get_high_water_mark() const noexcept;
+
+    //  ,         .
+    [[nodiscard]] size_t get_batch_size() const noexcept;
+
+    //           .
+    [[nodiscard]] thread_cache **get_first_thread_cache_address_address() const noexcept;
+
+    // ,       .
+    [[nodiscard]] std::mutex &get_backing_allocator_mutex() const noexcept;
+
+    //      ,     .
+    [[nodiscard]] thread_cache *get_current_thread_cache();
+
+    //      size_class_index,    .
+    void refill_thread_cache(
+        thread_cache *cache,
+        size_t size_class_index);
+
+    //    blocks_count    size_class_index  .
+    void drain_thread_cache(
+        thread_cache *cache,
+        size_t size_class_index,
+        size_t blocks_count);
+
+    //    size_class_index    ;    .
+    void deallocate_into_thread_cache(
+        void *block_to_deallocate_address,
+        size_t size_class_index);
+
+public:
+
+    //  :           .
+    [[nodiscard]] size_t get_natural_alignment() const noexcept override;
+
+    //     requested_block_size,      .
+    void *allocate(
+        size_t requested_block_size) override;
+
+    //     block_to_deallocate_address    .
+    void deallocate(
+        void *block_to_deallocate_address) override;
+
+    //   block_size   ;     block_size    .
+    void deallocate(
+        void *block_to_deallocate_address,
+        size_t block_size) override;
+
+    //  ,     new_block_size.
+    [[nodiscard]] void *reallocate(
+        void *block_to_reallocate_address,
+        size_t new_block_size) override;
+
+    //      .    ,    .
+    bool reallocate(
+        void **block_to_reallocate_address_address,
+        size_t new_block_size) override;
+
+private:
+
+    //    logger,    .
+    [[nodiscard]] logger *get_logger() const noexcept override;
+
+private:
+
+    //     (allocator_thread_cache).
+    [[nodiscard]] std::string get_typename() const noexcept override;
+
+private:
+
+    //    .
+    [[nodiscard]] allocator *get_allocator() const noexcept override;
+
+};
+
+#endif //DATA_STRUCTURES_CPP_MEMORY_WITH_THREAD_CACHE_H
\ No newline at end of file
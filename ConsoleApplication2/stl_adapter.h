@@ -0,0 +1,321 @@
+#ifndef DATA_STRUCTURES_CPP_STL_ADAPTER_H
+#define DATA_STRUCTURES_CPP_STL_ADAPTER_H
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include "allocator.h"
+
+//    stl_adapter (      ) :     .
+class stl_adapter_node_freelists final
+{
+
+private:
+
+    //   ,      .
+    static constexpr size_t _node_sizes_count = 8;
+
+    //     ,   .
+    static constexpr size_t _node_freelist_capacity = 256;
+
+private:
+
+    allocator *_backing_allocator;
+
+    size_t _references_count;
+
+    size_t _node_sizes[_node_sizes_count];
+
+    size_t _node_alignments[_node_sizes_count];
+
+    size_t _free_nodes_counts[_node_sizes_count];
+
+    void *_first_free_nodes[_node_sizes_count];
+
+private:
+
+    explicit stl_adapter_node_freelists(
+        allocator *backing_allocator) noexcept:
+        _backing_allocator(backing_allocator),
+        _references_count(1),
+        _node_sizes(),
+        _node_alignments(),
+        _free_nodes_counts(),
+        _first_free_nodes()
+    {
+
+    }
+
+    //     node_size   node_alignment;     .
+    //      ,  _node_sizes_count.
+    [[nodiscard]] size_t get_node_freelist_index(
+        size_t node_size,
+        size_t node_alignment) noexcept
+    {
+        for (size_t node_freelist_index = 0; node_freelist_index < _node_sizes_count; ++node_freelist_index)
+        {
+            if (_node_sizes[node_freelist_index] == 0)
+            {
+                _node_sizes[node_freelist_index] = node_size;
+                _node_alignments[node_freelist_index] = node_alignment;
+            }
+
+            if (_node_sizes[node_freelist_index] == node_size && _node_alignments[node_freelist_index] == node_alignment)
+            {
+                return node_freelist_index;
+            }
+        }
+
+        return _node_sizes_count;
+    }
+
+public:
+
+    //   block_size   block_alignment; ,     ,   allocate_aligned.
+    [[nodiscard]] static void *allocate_block(
+        allocator *backing_allocator,
+        size_t block_size,
+        size_t block_alignment)
+    {
+        if (block_alignment <= backing_allocator->get_natural_alignment())
+        {
+            return backing_allocator->allocate(block_size);
+        }
+
+        return backing_allocator->allocate_aligned(block_size, block_alignment);
+    }
+
+public:
+
+    stl_adapter_node_freelists(
+        stl_adapter_node_freelists const &other) = delete;
+
+    stl_adapter_node_freelists &operator=(
+        stl_adapter_node_freelists const &other) = delete;
+
+public:
+
+    //     backing_allocator.
+    [[nodiscard]] static stl_adapter_node_freelists *create(
+        allocator *backing_allocator)
+    {
+        return new (allocate_block(backing_allocator, sizeof(stl_adapter_node_freelists), alignof(stl_adapter_node_freelists)))
+            stl_adapter_node_freelists(backing_allocator);
+    }
+
+    //     .
+    void acquire() noexcept
+    {
+        ++_references_count;
+    }
+
+    //  ;          .
+    void release() noexcept
+    {
+        if (--_references_count != 0)
+        {
+            return;
+        }
+
+        auto *backing_allocator = _backing_allocator;
+
+        for (size_t node_freelist_index = 0; node_freelist_index < _node_sizes_count; ++node_freelist_index)
+        {
+            while (_first_free_nodes[node_freelist_index] != nullptr)
+            {
+                auto *node = _first_free_nodes[node_freelist_index];
+                _first_free_nodes[node_freelist_index] = *reinterpret_cast<void **>(node);
+                backing_allocator->deallocate(node, _node_sizes[node_freelist_index]);
+            }
+        }
+
+        this->~stl_adapter_node_freelists();
+        backing_allocator->deallocate(this, sizeof(stl_adapter_node_freelists));
+    }
+
+    // ,    .
+    [[nodiscard]] allocator *get_backing_allocator() const noexcept
+    {
+        return _backing_allocator;
+    }
+
+    //   node_size     ,   ,  .
+    [[nodiscard]] void *allocate_node(
+        size_t node_size,
+        size_t node_alignment)
+    {
+        auto const node_freelist_index = get_node_freelist_index(node_size, node_alignment);
+
+        if (node_freelist_index == _node_sizes_count || _first_free_nodes[node_freelist_index] == nullptr)
+        {
+            return allocate_block(_backing_allocator, node_size, node_alignment);
+        }
+
+        auto *node = _first_free_nodes[node_freelist_index];
+        _first_free_nodes[node_freelist_index] = *reinterpret_cast<void **>(node);
+        --_free_nodes_counts[node_freelist_index];
+
+        return node;
+    }
+
+    //        ,   ,   .
+    void deallocate_node(
+        void *node,
+        size_t node_size,
+        size_t node_alignment)
+    {
+        auto const node_freelist_index = get_node_freelist_index(node_size, node_alignment);
+
+        if (node_freelist_index == _node_sizes_count || _free_nodes_counts[node_freelist_index] == _node_freelist_capacity)
+        {
+            _backing_allocator->deallocate(node, node_size);
+            return;
+        }
+
+        *reinterpret_cast<void **>(node) = _first_free_nodes[node_freelist_index];
+        _first_free_nodes[node_freelist_index] = node;
+        ++_free_nodes_counts[node_freelist_index];
+    }
+
+};
+
+//       allocator*.   ( std::map, std::list  . .)
+//   ,     . ,    ,  .
+template<typename T>
+class stl_adapter
+{
+
+    template<typename U>
+    friend class stl_adapter;
+
+public:
+
+    using value_type = T;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+
+    using propagate_on_container_move_assignment = std::true_type;
+
+    using propagate_on_container_swap = std::true_type;
+
+    using is_always_equal = std::false_type;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = stl_adapter<U>;
+    };
+
+private:
+
+    // :         .
+    static constexpr size_t _node_size = sizeof(T) < sizeof(void *)
+        ? sizeof(void *)
+        : sizeof(T);
+
+    // ,    T,       .
+    static constexpr size_t _node_alignment = alignof(T) < alignof(void *)
+        ? alignof(void *)
+        : alignof(T);
+
+private:
+
+    stl_adapter_node_freelists *_node_freelists;
+
+public:
+
+    // ,    backing_allocator (     ).
+    explicit stl_adapter(
+        allocator *backing_allocator):
+        _node_freelists(stl_adapter_node_freelists::create(backing_allocator))
+    {
+
+    }
+
+    stl_adapter(
+        stl_adapter const &other) noexcept:
+        _node_freelists(other._node_freelists)
+    {
+        _node_freelists->acquire();
+    }
+
+    template<typename U>
+    stl_adapter(
+        stl_adapter<U> const &other) noexcept:
+        _node_freelists(other._node_freelists)
+    {
+        _node_freelists->acquire();
+    }
+
+    stl_adapter &operator=(
+        stl_adapter const &other) noexcept
+    {
+        if (this != &other)
+        {
+            other._node_freelists->acquire();
+            _node_freelists->release();
+            _node_freelists = other._node_freelists;
+        }
+
+        return *this;
+    }
+
+    ~stl_adapter() noexcept
+    {
+        _node_freelists->release();
+    }
+
+public:
+
+    //   objects_count ;       .
+    [[nodiscard]] T *allocate(
+        size_t objects_count)
+    {
+        if (objects_count == 1)
+        {
+            return reinterpret_cast<T *>(_node_freelists->allocate_node(_node_size, _node_alignment));
+        }
+
+        if (objects_count > std::numeric_limits<size_t>::max() / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+
+        return reinterpret_cast<T *>(stl_adapter_node_freelists::allocate_block(_node_freelists->get_backing_allocator(), objects_count * sizeof(T), alignof(T)));
+    }
+
+    //   objects_count ;       .
+    void deallocate(
+        T *objects,
+        size_t objects_count)
+    {
+        if (objects_count == 1)
+        {
+            _node_freelists->deallocate_node(objects, _node_size, _node_alignment);
+            return;
+        }
+
+        _node_freelists->get_backing_allocator()->deallocate(objects, objects_count * sizeof(T));
+    }
+
+public:
+
+    // ,       :  ,  ,    .
+    template<typename U>
+    [[nodiscard]] bool operator==(
+        stl_adapter<U> const &other) const noexcept
+    {
+        return _node_freelists == other._node_freelists;
+    }
+
+    template<typename U>
+    [[nodiscard]] bool operator!=(
+        stl_adapter<U> const &other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+};
+
+#endif //DATA_STRUCTURES_CPP_STL_ADAPTER_H
\ No newline at end of file